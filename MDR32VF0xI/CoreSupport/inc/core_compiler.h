@@ -73,6 +73,12 @@ extern "C" {
 #ifndef   __PACKED_STRUCT
   #define __PACKED_STRUCT                        struct __attribute__((packed, aligned(1)))
 #endif
+#ifndef   __COMPILER_BARRIER
+  #define __COMPILER_BARRIER()                   __ASM volatile("" ::: "memory")
+#endif
+#ifndef   __WFI
+  #define __WFI()                                __ASM volatile("wfi" ::: "memory")
+#endif
 
 #if defined(__GNUC__)       /* GCC compiler. */
 #ifndef __INTERRUPT_MACHINE
@@ -84,6 +90,21 @@ extern "C" {
 #ifndef __INTERRUPT_USER
   #define __INTERRUPT_USER                       __attribute__((interrupt("user")))
 #endif
+#ifndef __NOINIT
+  #define __NOINIT                               __attribute__((section(".noinit")))
+#endif
+#ifndef __RAMFUNC
+  #define __RAMFUNC                              __attribute__((section(".ramfunc"), noinline))
+#endif
+#ifndef __STARTUPFUNC
+  #define __STARTUPFUNC                          __attribute__((section(".text.init"), noinline, no_instrument_function, optimize("no-tree-loop-distribute-patterns")))
+#endif
+#ifndef __OVERLAY
+  #define __OVERLAY(N)                           __attribute__((section(".overlay" #N), noinline))
+#endif
+#ifndef __NO_INSTRUMENT
+  #define __NO_INSTRUMENT                        __attribute__((no_instrument_function))
+#endif
 #elif defined(__ICCRISCV__) /* IAR RISC-V compiler. */
 #ifndef __INTERRUPT_MACHINE
   #define __INTERRUPT_MACHINE                    __interrupt __machine
@@ -94,6 +115,21 @@ extern "C" {
 #ifndef __INTERRUPT_USER
   #define __INTERRUPT_USER                       __interrupt __user
 #endif
+#ifndef __NOINIT
+  #define __NOINIT                               __no_init
+#endif
+#ifndef __RAMFUNC
+  #define __RAMFUNC                              __ramfunc
+#endif
+#ifndef __STARTUPFUNC
+  #define __STARTUPFUNC
+#endif
+#ifndef __OVERLAY
+  #define __OVERLAY(N)
+#endif
+#ifndef __NO_INSTRUMENT
+  #define __NO_INSTRUMENT
+#endif
 #endif
 
 /** @} */ /* End of the group CORE_COMPILER */
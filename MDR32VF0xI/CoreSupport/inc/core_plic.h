@@ -76,6 +76,15 @@ extern "C" {
 #define PLIC_PTHR              (PLIC_BASE + 0x200000)         /*!< PLIC Priority Threshold. */
 #define PLIC_ICR               (PLIC_BASE + 0x200004)         /*!< PLIC Interrupt Claim Register and Interrupt Completion. */
 
+/* PLIC register access of the inline functions. Can be defined before
+   the header is included to redirect the accesses to a host-side stand-in. */
+#ifndef PLIC_READ_REG
+#define PLIC_READ_REG(ADDR)       (*(volatile uint32_t*)(ADDR))
+#endif
+#ifndef PLIC_WRITE_REG
+#define PLIC_WRITE_REG(ADDR, VAL) (*(volatile uint32_t*)(ADDR) = (uint32_t)(VAL))
+#endif
+
 /** @} */ /* End of group CORE_PLIC_Exported_Defines */
 
 /** @defgroup CORE_PLIC_CSR_MCAUSE PLIC CSR MCAUSE
@@ -389,6 +398,53 @@ IRQHandler_TypeDef PLIC_GetTrapVector(PLIC_PrivilegeIRQ_TypeDef Privilege);
 
 /** @} */ /* End of the group CORE_PLIC_Exported_Functions */
 
+/** @addtogroup CORE_PLIC_Exported_Inline_Functions PLIC Exported Inline Functions
+ * @{
+ */
+
+/**
+ * @brief  Claim an external interrupt without the IRQn translation.
+ * @param  None.
+ * @return PLIC source ID (IRQn + 1), 0 if there is no pending interrupt.
+ */
+__STATIC_FORCEINLINE uint32_t PLIC_FastClaimIRQ(void)
+{
+    return PLIC_READ_REG(PLIC_ICR);
+}
+
+/**
+ * @brief  Complete an external interrupt claimed by PLIC_FastClaimIRQ.
+ * @param  SourceID: PLIC source ID returned by PLIC_FastClaimIRQ.
+ * @return None.
+ */
+__STATIC_FORCEINLINE void PLIC_FastCompleteIRQ(uint32_t SourceID)
+{
+    PLIC_WRITE_REG(PLIC_ICR, SourceID);
+}
+
+/**
+ * @brief  Claim, dispatch and complete the pending external interrupts
+ *         until there are none left.
+ * @param  VectorTable: External interrupt handlers indexed by IRQn.
+ * @return Number of the dispatched interrupts.
+ */
+__STATIC_FORCEINLINE uint32_t PLIC_DispatchIRQ(IRQHandler_TypeDef const* VectorTable)
+{
+    uint32_t SourceID, Count = 0;
+
+    SourceID = PLIC_FastClaimIRQ();
+    while (SourceID != 0) {
+        (*VectorTable[SourceID - 1])();
+        PLIC_FastCompleteIRQ(SourceID);
+        Count++;
+        SourceID = PLIC_FastClaimIRQ();
+    }
+
+    return Count;
+}
+
+/** @} */ /* End of the group CORE_PLIC_Exported_Inline_Functions */
+
 /** @} */ /* End of group CORE_PLIC_Hardware_Abstraction_Layer */
 
 /** @} */ /* End of the group CORE_PLIC */
@@ -29,6 +29,7 @@ extern "C" {
 
 /* Includes ------------------------------------------------------------------*/
 #include "system_MDR32VF0xI_config.h"
+#include "system_MDR32VF0xI_clktree.h"
 
 /** @addtogroup DEVICE_SUPPORT Device Support
  * @{
@@ -46,7 +47,12 @@ extern "C" {
  * @{
  */
 
+#if (CLKTREE_STATIC == 1)
+#define SystemCoreClock CLKTREE_HCLK_Hz /*!< System Clock Frequency (Core Clock) of the static clock tree */
+#else
 extern uint32_t SystemCoreClock; /*!< System Clock Frequency (Core Clock) default value */
+#endif
+extern uint32_t SystemHSIClock; /*!< HSI Frequency, HSI_FREQUENCY_Hz or measured by HSICAL */
 
 /** @} */ /* End of group MDR32VF0xI_System_Exported_Variables */
 
@@ -57,6 +63,10 @@ extern uint32_t SystemCoreClock; /*!< System Clock Frequency (Core Clock) defaul
 void SystemInit(void);
 void SystemCoreClockUpdate(void);
 
+#if (CLKTREE_STATIC == 0)
+uint32_t SystemClockConfig(uint32_t TargetFreq);
+#endif
+
 /** @} */ /* End of group MDR32VF0xI_System_Exported_Functions */
 
 /** @} */ /* End of group MDR32VF0xI_System */
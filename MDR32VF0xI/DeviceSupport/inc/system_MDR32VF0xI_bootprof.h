@@ -0,0 +1,160 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_bootprof.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the functions prototypes for the boot phase
+ *          profiler (BOOTPROF).
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_BOOTPROF_H
+#define SYSTEM_MDR32VF0xI_BOOTPROF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_config.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_BOOTPROF MDR32VF0xI System BOOTPROF
+ * @{
+ */
+
+#if (STARTUP_MEASURE_CYCLES == 1)
+
+/** @addtogroup MDR32VF0xI_System_BOOTPROF_Exported_Defines MDR32VF0xI System BOOTPROF Exported Defines
+ * @{
+ */
+
+/**
+ * @brief BOOTPROF record identification, checked by BOOTPROF_Start and the host decoder
+ *        (MDR32VF0xI/Tools/bootprof_decode.py).
+ */
+#define BOOTPROF_MAGIC   0x46525042UL /* "BPRF" */
+#define BOOTPROF_VERSION 1U
+
+/**
+ * @brief BOOTPROF number of the marks in a record, the later marks are dropped.
+ */
+#define BOOTPROF_NUM_MARKS 24U
+
+/** @defgroup MDR32VF0xI_System_BOOTPROF_Mark_Id MDR32VF0xI System BOOTPROF Mark Id
+ * @brief Boot phase boundaries in the boot order, a mark ends the phase started by the previous one.
+ *        The startup file includes this header, so only the defines are visible to the assembler.
+ * @{
+ */
+
+#define BOOTPROF_ID_START        0  /*!< _start entry, MCYCLE counts the reset and the boot ROM time. */
+#define BOOTPROF_ID_COPY         1  /*!< Copy of the __copy_table sections by the CPU, DMA start. */
+#define BOOTPROF_ID_ZERO         2  /*!< Zeroing of the __zero_table sections. */
+#define BOOTPROF_ID_DMA_WAIT     3  /*!< Wait for the DMA section copy (STARTUP_USE_DMA is 1). */
+#define BOOTPROF_ID_LIBC_INIT    4  /*!< __libc_init_array (static constructors). */
+#define BOOTPROF_ID_SYSTEM_IT    5  /*!< SystemInit: interrupt stack and interrupt controller. */
+#define BOOTPROF_ID_SYSTEM_CLOCK 6  /*!< SystemInit: clock tree, SystemCoreClockUpdate. */
+#define BOOTPROF_ID_SYSTEM_INIT  7  /*!< SystemInit return, main is called. */
+#define BOOTPROF_ID_USER         16 /*!< First identifier of the application marks (BOOTPROF_Mark in main). */
+
+/** @} */ /* End of the group MDR32VF0xI_System_BOOTPROF_Mark_Id */
+
+/** @} */ /* End of the group MDR32VF0xI_System_BOOTPROF_Exported_Defines */
+
+#ifndef __ASSEMBLER__
+
+/** @addtogroup MDR32VF0xI_System_BOOTPROF_Exported_Types MDR32VF0xI System BOOTPROF Exported Types
+ * @{
+ */
+
+/**
+ * @brief BOOTPROF phase boundary mark.
+ */
+typedef struct {
+    uint32_t Cycles;      /*!< MCYCLE lower 32 bits at the mark. */
+    uint32_t ClockFreq;   /*!< Core clock frequency from the mark to the next one [Hz]. */
+    uint8_t  Id;          /*!< Mark identifier, BOOTPROF_ID_*. */
+    uint8_t  Reserved[3]; /*!< Reserved, zero. */
+} BOOTPROF_Mark_TypeDef;
+
+/**
+ * @brief BOOTPROF record of a boot, placed in the .noinit section so that it can be
+ *        read from a memory dump after a warm reset.
+ * @note  The layout is decoded by MDR32VF0xI/Tools/bootprof_decode.py,
+ *        BOOTPROF_VERSION should be changed with it.
+ */
+typedef struct {
+    uint32_t              Magic;                    /*!< BOOTPROF_MAGIC if the record is valid. */
+    uint16_t              Version;                  /*!< BOOTPROF_VERSION. */
+    uint8_t               NumMarks;                 /*!< BOOTPROF_NUM_MARKS. */
+    uint8_t               Count;                    /*!< Number of the recorded marks. */
+    uint32_t              BootCount;                /*!< Boot number since the record was invalid (power-on), from 1. */
+    BOOTPROF_Mark_TypeDef Mark[BOOTPROF_NUM_MARKS]; /*!< Marks in the record order. */
+} BOOTPROF_Record_TypeDef;
+
+/** @} */ /* End of the group MDR32VF0xI_System_BOOTPROF_Exported_Types */
+
+/** @addtogroup MDR32VF0xI_System_BOOTPROF_Exported_Variables MDR32VF0xI System BOOTPROF Exported Variables
+ * @{
+ */
+
+/**
+ * @brief BOOTPROF record of the current boot.
+ */
+extern BOOTPROF_Record_TypeDef BOOTPROF_Record;
+
+/**
+ * @brief BOOTPROF record of the previous boot (up to the warm reset), Magic is 0 after power-on.
+ */
+extern BOOTPROF_Record_TypeDef BOOTPROF_PrevRecord;
+
+/** @} */ /* End of the group MDR32VF0xI_System_BOOTPROF_Exported_Variables */
+
+/** @addtogroup MDR32VF0xI_System_BOOTPROF_Exported_Functions MDR32VF0xI System BOOTPROF Exported Functions
+ * @{
+ */
+
+void BOOTPROF_Start(uint32_t StartCycles, uint32_t CopyCycles, uint32_t ZeroCycles, uint32_t DMAWaitCycles);
+void BOOTPROF_Mark(uint32_t Id);
+
+/** @} */ /* End of the group MDR32VF0xI_System_BOOTPROF_Exported_Functions */
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* STARTUP_MEASURE_CYCLES == 1 */
+
+/** @} */ /* End of the group MDR32VF0xI_System_BOOTPROF */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_BOOTPROF_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_bootprof.h */
@@ -0,0 +1,111 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_clkcfg.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the functions prototypes for the clock
+ *          configuration solver (CLKCFG).
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_CLKCFG_H
+#define SYSTEM_MDR32VF0xI_CLKCFG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include "system_MDR32VF0xI_config.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_CLKCFG MDR32VF0xI System CLKCFG
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_CLKCFG_Exported_Types MDR32VF0xI System CLKCFG Exported Types
+ * @{
+ */
+
+/**
+ * @brief CLKCFG clock generator.
+ */
+typedef enum {
+    CLKCFG_SOURCE_HSI = 0x0, /*!< HSI generator. */
+    CLKCFG_SOURCE_HSE = 0x1  /*!< HSE generator. */
+} CLKCFG_Source_TypeDef;
+
+#define IS_CLKCFG_SOURCE(SOURCE) (((SOURCE) == CLKCFG_SOURCE_HSI) || \
+                                  ((SOURCE) == CLKCFG_SOURCE_HSE))
+
+/**
+ * @brief CLKCFG clock configuration: HCLK = CPU_C3 = (CPU_C1 * PLLMul) / CPU_C3Div.
+ */
+typedef struct {
+    uint32_t CPU_C1Sel;  /*!< CPU_C1 source, @ref RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSI ... RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSE_DIV_2. */
+    uint32_t PLLMul;     /*!< CPU PLL multiplier 2..16, 0 if the PLL is not used (CPU_C2 = CPU_C1). */
+    uint32_t CPU_C3Div;  /*!< CPU_C3 divider: 1, 2, 4, ..., 256. */
+    uint32_t FlashDelay; /*!< FLASH wait states, @ref FLASH_CMD_DELAY_CYCLE_0 or FLASH_CMD_DELAY_CYCLE_1. */
+    uint32_t Frequency;  /*!< Resulting HCLK frequency [Hz]. */
+} CLKCFG_Config_TypeDef;
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLKCFG_Exported_Types */
+
+/** @addtogroup MDR32VF0xI_System_CLKCFG_Exported_Defines MDR32VF0xI System CLKCFG Exported Defines
+ * @{
+ */
+
+#define CLKCFG_PLL_MUL_MIN      2  /*!< Minimum CPU PLL multiplier used by the solver. */
+#define CLKCFG_PLL_MUL_MAX      16 /*!< Maximum CPU PLL multiplier (PLL_CPU_MUL + 1). */
+#define CLKCFG_C3_DIV_SHIFT_MAX 8  /*!< Maximum CPU_C3 divider as a power of 2 (divide by 256). */
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLKCFG_Exported_Defines */
+
+/** @addtogroup MDR32VF0xI_System_CLKCFG_Exported_Functions MDR32VF0xI System CLKCFG Exported Functions
+ * @{
+ */
+
+ErrorStatus CLKCFG_Solve(CLKCFG_Config_TypeDef* Config, CLKCFG_Source_TypeDef Source,
+                         uint32_t SourceFreq, uint32_t TargetFreq);
+uint32_t    CLKCFG_GetFlashDelay(uint32_t Frequency);
+
+ErrorStatus CLKCFG_Apply(const CLKCFG_Config_TypeDef* Config);
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLKCFG_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLKCFG */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_CLKCFG_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_clkcfg.h */
@@ -0,0 +1,145 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_clktree.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains the compile-time evaluation of the static
+ *          clock tree (CLKTREE).
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_CLKTREE_H
+#define SYSTEM_MDR32VF0xI_CLKTREE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_config.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_CLKTREE MDR32VF0xI System CLKTREE
+ * @{
+ */
+
+#if (CLKTREE_STATIC == 1)
+
+/** @addtogroup MDR32VF0xI_System_CLKTREE_Exported_Defines MDR32VF0xI System CLKTREE Exported Defines
+ * @{
+ */
+
+/** @defgroup MDR32VF0xI_System_CLKTREE_Frequencies MDR32VF0xI System CLKTREE Frequencies
+ * @brief Static clock tree frequencies [Hz], constant expressions of the CLKTREE_*
+ *        parameters of system_MDR32VF0xI_config.h. SystemCoreClock is CLKTREE_HCLK_Hz.
+ * @{
+ */
+
+#if (CLKTREE_USE_HSE == 1)
+#define CLKTREE_GENERATOR_Hz HSE_FREQUENCY_Hz
+#else
+#define CLKTREE_GENERATOR_Hz HSI_FREQUENCY_Hz
+#endif
+
+#define CLKTREE_CPU_C1_Hz ((uint32_t)(CLKTREE_GENERATOR_Hz / CLKTREE_CPU_C1_DIV))
+
+#if (CLKTREE_PLL_MUL != 0)
+#define CLKTREE_CPU_C2_Hz ((uint32_t)(CLKTREE_CPU_C1_Hz * CLKTREE_PLL_MUL))
+#else
+#define CLKTREE_CPU_C2_Hz CLKTREE_CPU_C1_Hz
+#endif
+
+#define CLKTREE_HCLK_Hz ((uint32_t)(CLKTREE_CPU_C2_Hz / CLKTREE_CPU_C3_DIV))
+
+#if defined(USE_MDR32F02_REV_1X)
+#define CLKTREE_MTIME_Hz CLKTREE_HCLK_Hz
+#else
+#define CLKTREE_MTIME_Hz ((uint32_t)(CLKTREE_HCLK_Hz / (CLKTREE_DIV_SYS_TIM + 1)))
+#endif
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLKTREE_Frequencies */
+
+/** @defgroup MDR32VF0xI_System_CLKTREE_Config MDR32VF0xI System CLKTREE Config
+ * @brief Static clock tree register settings, see CLKCFG_Config_TypeDef.
+ * @{
+ */
+
+#if (CLKTREE_USE_HSE == 1)
+#define CLKTREE_CPU_C1_SEL ((CLKTREE_CPU_C1_DIV == 1) ? RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSE : RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSE_DIV_2)
+#else
+#define CLKTREE_CPU_C1_SEL ((CLKTREE_CPU_C1_DIV == 1) ? RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSI : RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSI_DIV_2)
+#endif
+
+#define CLKTREE_FLASH_DELAY ((CLKTREE_HCLK_Hz <= CLKCFG_FLASH_DELAY_0_MAX_Hz) ? FLASH_CMD_DELAY_CYCLE_0 : FLASH_CMD_DELAY_CYCLE_1)
+
+/** CLKCFG_Config_TypeDef initializer for CLKCFG_Apply. */
+#define CLKTREE_CONFIG_INIT \
+    { CLKTREE_CPU_C1_SEL, CLKTREE_PLL_MUL, CLKTREE_CPU_C3_DIV, CLKTREE_FLASH_DELAY, CLKTREE_HCLK_Hz }
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLKTREE_Config */
+
+/** @defgroup MDR32VF0xI_System_CLKTREE_Dividers MDR32VF0xI System CLKTREE Dividers
+ * @brief Peripheral dividers computed at compile time. BRG is the peripheral
+ *        clock prescaler field value of the UART_CLOCK or TIM_CLOCK register (0..7),
+ *        the peripheral clock is HCLK / 2^BRG.
+ * @{
+ */
+
+#define CLKTREE_PERIPH_Hz(BRG) ((uint32_t)(CLKTREE_HCLK_Hz >> (BRG)))
+
+/** UART baud rate divider in 1/64 units, rounded to the nearest: PERIPH_Hz / (16 * BAUD) * 64. */
+#define CLKTREE_UART_DIV64(BRG, BAUD) ((uint32_t)((4U * CLKTREE_PERIPH_Hz(BRG) + (BAUD) / 2U) / (BAUD)))
+#define CLKTREE_UART_IBRD(BRG, BAUD)  (CLKTREE_UART_DIV64(BRG, BAUD) >> 6)   /*!< UART IBRD register value. */
+#define CLKTREE_UART_FBRD(BRG, BAUD)  (CLKTREE_UART_DIV64(BRG, BAUD) & 0x3FU) /*!< UART FBRD register value. */
+
+/** TIMER PSG register value for the counter clock CNT_HZ. */
+#define CLKTREE_TIMER_PSG(BRG, CNT_HZ)      ((uint32_t)(CLKTREE_PERIPH_Hz(BRG) / (CNT_HZ) - 1U))
+/** TIMER ARR register value for the period event EVENT_HZ with the counter clock CNT_HZ. */
+#define CLKTREE_TIMER_ARR(CNT_HZ, EVENT_HZ) ((uint32_t)((CNT_HZ) / (EVENT_HZ) - 1U))
+
+/** Number of the core cycles in US microseconds, for example, DELAY_Cycles(CLKTREE_US_TO_CYCLES(10)). */
+#define CLKTREE_US_TO_CYCLES(US) ((uint32_t)(((uint64_t)(US) * CLKTREE_HCLK_Hz) / 1000000U))
+/** Number of the MTIME ticks in MS milliseconds. */
+#define CLKTREE_MS_TO_TICKS(MS)  ((uint64_t)(MS) * CLKTREE_MTIME_Hz / 1000U)
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLKTREE_Dividers */
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLKTREE_Exported_Defines */
+
+#endif
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLKTREE */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_CLKTREE_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_clktree.h */
@@ -0,0 +1,249 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_clock.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the functions prototypes for the monotonic
+ *          clock (CLOCK).
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_CLOCK_H
+#define SYSTEM_MDR32VF0xI_CLOCK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_config.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_CLOCK MDR32VF0xI System CLOCK
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_CLOCK_Exported_Defines MDR32VF0xI System CLOCK Exported Defines
+ * @{
+ */
+
+#define CLOCK_NS_PER_SECOND 1000000000UL
+#define CLOCK_US_PER_SECOND 1000000UL
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLOCK_Exported_Defines */
+
+/** @addtogroup MDR32VF0xI_System_CLOCK_Exported_Types MDR32VF0xI System CLOCK Exported Types
+ * @{
+ */
+
+/**
+ * @brief CLOCK fixed-point conversion factor: Out = (In * Mult) >> Shift.
+ */
+typedef struct {
+    uint32_t Mult;  /*!< Multiplier, Out / In ratio scaled by 2^Shift. */
+    uint32_t Shift; /*!< Shift, 0..63. */
+} CLOCK_Conv_TypeDef;
+
+/**
+ * @brief CLOCK calibration computed by CLOCK_Init.
+ */
+typedef struct {
+    uint32_t           TickFreq;   /*!< Machine timer (MTIME) frequency [Hz]. */
+    uint32_t           CycleFreq;  /*!< Core clock (MCYCLE) frequency [Hz], SystemCoreClock. */
+    CLOCK_Conv_TypeDef TicksToNs;  /*!< MTIME ticks to nanoseconds. */
+    CLOCK_Conv_TypeDef NsToTicks;  /*!< Nanoseconds to MTIME ticks. */
+    CLOCK_Conv_TypeDef CyclesToNs; /*!< Core cycles to nanoseconds. */
+    CLOCK_Conv_TypeDef NsToCycles; /*!< Nanoseconds to core cycles. */
+    CLOCK_Conv_TypeDef UsToCycles; /*!< Microseconds to core cycles. */
+    uint64_t           BaseTicks;  /*!< MTIME at the last recalibration. */
+    uint64_t           BaseNs;     /*!< Monotonic time at BaseTicks [ns]. */
+} CLOCK_Calib_TypeDef;
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLOCK_Exported_Types */
+
+/** @addtogroup MDR32VF0xI_System_CLOCK_Exported_Variables MDR32VF0xI System CLOCK Exported Variables
+ * @{
+ */
+
+/**
+ * @brief CLOCK calibration.
+ */
+extern CLOCK_Calib_TypeDef CLOCK_Calib;
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLOCK_Exported_Variables */
+
+/** @addtogroup MDR32VF0xI_System_CLOCK_Exported_Functions MDR32VF0xI System CLOCK Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Get the machine timer value.
+ * @note   Reads MTIME with the TIME CSRs if CLOCK_USE_TIME_CSR is 1,
+ *         through the CLINT registers otherwise.
+ * @param  None.
+ * @return 64-bit MTIME value.
+ */
+__STATIC_FORCEINLINE uint64_t CLOCK_GetTicks(void)
+{
+    uint32_t High, Low;
+
+#if (CLOCK_USE_TIME_CSR == 1)
+    do {
+        High = (uint32_t)csr_read(CSR_TIMEH);
+        Low  = (uint32_t)csr_read(CSR_TIME);
+    } while (High != (uint32_t)csr_read(CSR_TIMEH));
+#else
+    do {
+        High = *(volatile uint32_t*)(MTIME_BASE + 4);
+        Low  = *(volatile uint32_t*)(MTIME_BASE);
+    } while (High != *(volatile uint32_t*)(MTIME_BASE + 4));
+#endif
+
+    return ((uint64_t)High << 32) | Low;
+}
+
+/**
+ * @brief  Get the core cycle counter value.
+ * @param  None.
+ * @return 64-bit MCYCLE value.
+ */
+__STATIC_FORCEINLINE uint64_t CLOCK_GetCycles(void)
+{
+    uint32_t High, Low;
+
+    do {
+        High = (uint32_t)csr_read(CSR_MCYCLEH);
+        Low  = (uint32_t)csr_read(CSR_MCYCLE);
+    } while (High != (uint32_t)csr_read(CSR_MCYCLEH));
+
+    return ((uint64_t)High << 32) | Low;
+}
+
+/**
+ * @brief  Get a 32-bit time stamp for the tracing of the hot paths.
+ * @note   A single CSR read, wraps around every 2^32 core cycles.
+ * @param  None.
+ * @return Lower 32 bits of MCYCLE.
+ */
+__STATIC_FORCEINLINE uint32_t CLOCK_GetTimestamp(void)
+{
+    return (uint32_t)csr_read(CSR_MCYCLE);
+}
+
+/**
+ * @brief  Convert a value with a fixed-point factor: (Value * Mult) >> Shift
+ *         with a 96-bit intermediate product.
+ * @param  Value: Value to convert.
+ * @param  Conv: Pointer to the conversion factor.
+ * @return Converted value.
+ */
+__STATIC_INLINE uint64_t CLOCK_Convert(uint64_t Value, const CLOCK_Conv_TypeDef* Conv)
+{
+    uint64_t Low, High;
+
+    Low  = (uint64_t)(uint32_t)Value * Conv->Mult;
+    High = (Value >> 32) * Conv->Mult + (Low >> 32);
+
+    if (Conv->Shift >= 32) {
+        return High >> (Conv->Shift - 32);
+    }
+
+    return (High << (32 - Conv->Shift)) | ((uint32_t)Low >> Conv->Shift);
+}
+
+/**
+ * @brief  Convert the MTIME ticks to nanoseconds.
+ * @param  Ticks: Number of the MTIME ticks.
+ * @return Nanoseconds.
+ */
+__STATIC_INLINE uint64_t CLOCK_TicksToNs(uint64_t Ticks)
+{
+    return CLOCK_Convert(Ticks, &CLOCK_Calib.TicksToNs);
+}
+
+/**
+ * @brief  Convert nanoseconds to the MTIME ticks (rounded down).
+ * @param  Ns: Nanoseconds.
+ * @return Number of the MTIME ticks.
+ */
+__STATIC_INLINE uint64_t CLOCK_NsToTicks(uint64_t Ns)
+{
+    return CLOCK_Convert(Ns, &CLOCK_Calib.NsToTicks);
+}
+
+/**
+ * @brief  Convert the core cycles to nanoseconds.
+ * @param  Cycles: Number of the core cycles.
+ * @return Nanoseconds.
+ */
+__STATIC_INLINE uint64_t CLOCK_CyclesToNs(uint64_t Cycles)
+{
+    return CLOCK_Convert(Cycles, &CLOCK_Calib.CyclesToNs);
+}
+
+/**
+ * @brief  Convert nanoseconds to the core cycles (rounded down).
+ * @param  Ns: Nanoseconds.
+ * @return Number of the core cycles.
+ */
+__STATIC_INLINE uint64_t CLOCK_NsToCycles(uint64_t Ns)
+{
+    return CLOCK_Convert(Ns, &CLOCK_Calib.NsToCycles);
+}
+
+/**
+ * @brief  Get the monotonic time.
+ * @note   Only the MTIME ticks after the last recalibration are converted with
+ *         the current MTIME frequency, so the time does not jump when
+ *         the core clock or the machine timer prescaler changes.
+ * @param  None.
+ * @return Nanoseconds since the machine timer start.
+ */
+__STATIC_INLINE uint64_t CLOCK_GetNs(void)
+{
+    return CLOCK_Calib.BaseNs + CLOCK_TicksToNs(CLOCK_GetTicks() - CLOCK_Calib.BaseTicks);
+}
+
+void CLOCK_Init(void);
+
+uint32_t CLOCK_GetTickFreq(void);
+
+void CLOCK_InitConv(CLOCK_Conv_TypeDef* Conv, uint32_t InFreq, uint32_t OutFreq);
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLOCK_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLOCK */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_CLOCK_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_clock.h */
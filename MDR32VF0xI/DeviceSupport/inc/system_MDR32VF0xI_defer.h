@@ -0,0 +1,126 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_defer.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the functions prototypes for the deferred
+ *          work (DEFER) firmware library.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_DEFER_H
+#define SYSTEM_MDR32VF0xI_DEFER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include "system_MDR32VF0xI_config.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_DEFER MDR32VF0xI System DEFER
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_DEFER_Exported_Types MDR32VF0xI System DEFER Exported Types
+ * @{
+ */
+
+/**
+ * @brief DEFER work function.
+ */
+typedef void (*DEFER_WorkFunc_TypeDef)(void* Arg);
+
+/**
+ * @brief DEFER work item.
+ */
+typedef struct {
+    DEFER_WorkFunc_TypeDef Func;      /*!< Work function. */
+    void*                  Arg;       /*!< Work function argument. */
+    uint32_t               Timestamp; /*!< MCYCLE value at the moment of posting. */
+} DEFER_Item_TypeDef;
+
+/**
+ * @brief DEFER queue statistics.
+ */
+typedef struct {
+    uint32_t Posted;       /*!< Number of the posted items (producer side). */
+    uint32_t Overflows;    /*!< Number of the items rejected because the queue was full (producer side). */
+    uint32_t MaxDepth;     /*!< Maximum number of the pending items (producer side). */
+    uint32_t Executed;     /*!< Number of the executed items (consumer side). */
+    uint32_t MaxLatency;   /*!< Maximum time from posting to execution start [core clock cycles]. */
+    uint64_t TotalLatency; /*!< Sum of the times from posting to execution start [core clock cycles]. */
+    uint32_t MaxRunTime;   /*!< Maximum execution time of a work function [core clock cycles]. */
+    uint64_t TotalRunTime; /*!< Sum of the execution times of the work functions [core clock cycles]. */
+} DEFER_Stats_TypeDef;
+
+/**
+ * @brief DEFER single-producer/single-consumer queue.
+ */
+typedef struct DEFER_Queue_Struct {
+    DEFER_Item_TypeDef*        Buffer;   /*!< Item buffer of Size elements. */
+    uint32_t                   Size;     /*!< Number of items in the buffer, power of 2. */
+    volatile uint32_t          Head;     /*!< Free-running write index (written only by the producer). */
+    volatile uint32_t          Tail;     /*!< Free-running read index (written only by the consumer). */
+    uint32_t                   Priority; /*!< Queue priority: 0 is the highest. */
+    DEFER_Stats_TypeDef        Stats;    /*!< Queue statistics. */
+    struct DEFER_Queue_Struct* Next;     /*!< Next registered queue of the same or lower priority. */
+} DEFER_Queue_TypeDef;
+
+#define IS_DEFER_QUEUE_SIZE(SIZE) (((SIZE) != 0) && (((SIZE) & ((SIZE) - 1)) == 0))
+
+/** @} */ /* End of the group MDR32VF0xI_System_DEFER_Exported_Types */
+
+/** @addtogroup MDR32VF0xI_System_DEFER_Exported_Functions MDR32VF0xI System DEFER Exported Functions
+ * @{
+ */
+
+void DEFER_Init(void);
+void DEFER_InitQueue(DEFER_Queue_TypeDef* Queue, DEFER_Item_TypeDef* Buffer, uint32_t Size, uint32_t Priority);
+
+ErrorStatus DEFER_Post(DEFER_Queue_TypeDef* Queue, DEFER_WorkFunc_TypeDef Func, void* Arg);
+uint32_t    DEFER_Process(void);
+uint32_t    DEFER_GetPending(const DEFER_Queue_TypeDef* Queue);
+
+void DEFER_GetStats(const DEFER_Queue_TypeDef* Queue, DEFER_Stats_TypeDef* Stats);
+void DEFER_ResetStats(DEFER_Queue_TypeDef* Queue);
+
+/** @} */ /* End of the group MDR32VF0xI_System_DEFER_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_DEFER */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_DEFER_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_defer.h */
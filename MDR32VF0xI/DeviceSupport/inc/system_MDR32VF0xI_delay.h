@@ -0,0 +1,101 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_delay.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the functions prototypes for the busy-wait
+ *          delays (DELAY).
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_DELAY_H
+#define SYSTEM_MDR32VF0xI_DELAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_clock.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_DELAY MDR32VF0xI System DELAY
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_DELAY_Exported_Functions MDR32VF0xI System DELAY Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Busy-wait a number of the core cycles, inline short path.
+ * @note   The wait is measured by MCYCLE, so it does not depend on the code
+ *         location (FLASH or TCM) and on the compiler optimization. The error
+ *         is one polling iteration: a few cycles when the caller runs from
+ *         TCM (.ramfunc), more with the FLASH wait states. Interrupts taken
+ *         during the wait extend it.
+ * @param  Cycles: Number of the core cycles.
+ * @return None.
+ */
+__STATIC_FORCEINLINE void DELAY_CyclesInline(uint32_t Cycles)
+{
+    uint32_t Start = (uint32_t)csr_read(CSR_MCYCLE);
+
+    while (((uint32_t)csr_read(CSR_MCYCLE) - Start) < Cycles) { }
+}
+
+/**
+ * @brief  Check if a 32-bit MCYCLE time stamp has been reached.
+ * @note   Valid for the time stamps less than 2^31 cycles ahead.
+ * @param  Timestamp: Time stamp, see CLOCK_GetTimestamp.
+ * @return @ref FlagStatus - SET if the time stamp has been reached, RESET otherwise.
+ */
+__STATIC_FORCEINLINE FlagStatus DELAY_IsTimestampReached(uint32_t Timestamp)
+{
+    return ((int32_t)((uint32_t)csr_read(CSR_MCYCLE) - Timestamp) >= 0) ? SET : RESET;
+}
+
+void DELAY_Cycles(uint32_t Cycles);
+void DELAY_Us(uint32_t Us);
+void DELAY_Ms(uint32_t Ms);
+
+void DELAY_WaitUntil(uint64_t Deadline);
+void DELAY_WaitUntilTimestamp(uint32_t Timestamp);
+
+/** @} */ /* End of the group MDR32VF0xI_System_DELAY_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_DELAY */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_DELAY_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_delay.h */
@@ -0,0 +1,110 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_freq.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the functions prototypes for the runtime
+ *          frequency scaling (FREQ).
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_FREQ_H
+#define SYSTEM_MDR32VF0xI_FREQ_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include "system_MDR32VF0xI_config.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_FREQ MDR32VF0xI System FREQ
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_FREQ_Exported_Types MDR32VF0xI System FREQ Exported Types
+ * @{
+ */
+
+/**
+ * @brief FREQ clock change event.
+ */
+typedef enum {
+    FREQ_EVENT_PRE_CHANGE  = 0x0, /*!< The core clock is about to change: stop the transfers depending on it. */
+    FREQ_EVENT_POST_CHANGE = 0x1  /*!< The core clock has changed (SystemCoreClock is updated): recompute the dividers. */
+} FREQ_Event_TypeDef;
+
+/**
+ * @brief FREQ clock change callback.
+ * @note  Called from FREQ_SetFrequency or FREQ_SetLSI with the interrupts
+ *        in the caller state. On POST_CHANGE NewFreq is the achieved frequency,
+ *        it can differ from the one of PRE_CHANGE if HSE or the PLL did not start.
+ * @param Event: @ref FREQ_Event_TypeDef - clock change event.
+ * @param OldFreq: Core clock frequency before the change [Hz].
+ * @param NewFreq: Core clock frequency after the change [Hz].
+ * @param Context: Context given in FREQ_RegisterNotifier.
+ */
+typedef void (*FREQ_Callback_TypeDef)(FREQ_Event_TypeDef Event, uint32_t OldFreq, uint32_t NewFreq, void* Context);
+
+/**
+ * @brief FREQ clock change notifier, owned by the driver.
+ */
+typedef struct FREQ_Notifier_TypeDef {
+    struct FREQ_Notifier_TypeDef* Next;     /*!< Next notifier in the chain. */
+    FREQ_Callback_TypeDef         Callback; /*!< Clock change callback. */
+    void*                         Context;  /*!< Callback context. */
+} FREQ_Notifier_TypeDef;
+
+/** @} */ /* End of the group MDR32VF0xI_System_FREQ_Exported_Types */
+
+/** @addtogroup MDR32VF0xI_System_FREQ_Exported_Functions MDR32VF0xI System FREQ Exported Functions
+ * @{
+ */
+
+void FREQ_RegisterNotifier(FREQ_Notifier_TypeDef* Notifier, FREQ_Callback_TypeDef Callback, void* Context);
+void FREQ_UnregisterNotifier(FREQ_Notifier_TypeDef* Notifier);
+
+uint32_t FREQ_SetFrequency(uint32_t TargetFreq);
+uint32_t FREQ_SetLSI(void);
+
+uint32_t FREQ_GetLatency(void);
+
+/** @} */ /* End of the group MDR32VF0xI_System_FREQ_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_FREQ */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_FREQ_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_freq.h */
@@ -0,0 +1,156 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_funcprof.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the functions prototypes for the function
+ *          profiler (FUNCPROF).
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_FUNCPROF_H
+#define SYSTEM_MDR32VF0xI_FUNCPROF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_config.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_FUNCPROF MDR32VF0xI System FUNCPROF
+ * @{
+ */
+
+#if (USE_FUNCPROF == 1)
+
+/** @addtogroup MDR32VF0xI_System_FUNCPROF_Exported_Defines MDR32VF0xI System FUNCPROF Exported Defines
+ * @{
+ */
+
+/**
+ * @brief FUNCPROF block identification, checked by the hooks and the host tool
+ *        (MDR32VF0xI/Tools/ramfunc_place.py).
+ */
+#define FUNCPROF_MAGIC   0x46525046UL /* "FPRF" */
+#define FUNCPROF_VERSION 1U
+
+/**
+ * @brief FUNCPROF entry index of the functions not found in the full table.
+ */
+#define FUNCPROF_NO_ENTRY 0xFFFFFFFFUL
+
+/** @} */ /* End of the group MDR32VF0xI_System_FUNCPROF_Exported_Defines */
+
+/** @addtogroup MDR32VF0xI_System_FUNCPROF_Exported_Types MDR32VF0xI System FUNCPROF Exported Types
+ * @{
+ */
+
+/**
+ * @brief FUNCPROF per-function statistics.
+ * @note  Self cycles are the MCYCLE cycles from the function entry to its return
+ *        without the instrumented callees and the profiler hooks, the code that is
+ *        not instrumented (libraries, interrupted time) is counted in its caller.
+ */
+typedef struct {
+    uint32_t Func;       /*!< Function address, 0 if the entry is free. */
+    uint32_t Calls;      /*!< Number of the calls. */
+    uint64_t SelfCycles; /*!< Self cycles of all the calls. */
+} FUNCPROF_Entry_TypeDef;
+
+/**
+ * @brief FUNCPROF call stack frame.
+ */
+typedef struct {
+    uint32_t Index;       /*!< Entry index of the function, FUNCPROF_NO_ENTRY if not recorded. */
+    uint32_t HookCycles;  /*!< MCYCLE at the entry hook start. */
+    uint32_t EnterCycles; /*!< MCYCLE at the entry hook end. */
+    uint32_t ChildCycles; /*!< Cycles of the callees including their hooks. */
+} FUNCPROF_Frame_TypeDef;
+
+/**
+ * @brief FUNCPROF statistics block, placed in the .noinit section so that it can be
+ *        read from a memory dump after a warm reset.
+ * @note  The layout is decoded by MDR32VF0xI/Tools/ramfunc_place.py,
+ *        FUNCPROF_VERSION should be changed with it. The hooks do not use
+ *        the block until FUNCPROF_Init after a reset.
+ */
+typedef struct {
+    uint32_t               Magic;                       /*!< FUNCPROF_MAGIC if the block is valid. */
+    uint16_t               Version;                     /*!< FUNCPROF_VERSION. */
+    uint16_t               NumEntries;                  /*!< FUNCPROF_NUM_ENTRIES. */
+    uint8_t                StackDepth;                  /*!< FUNCPROF_STACK_DEPTH. */
+    uint8_t                Running;                     /*!< 1 from FUNCPROF_Init to FUNCPROF_Stop (or a reset). */
+    uint16_t               Reserved;                    /*!< Reserved, zero. */
+    uint32_t               ClockFreq;                   /*!< MCYCLE clock frequency [Hz]. */
+    uint32_t               Calls;                       /*!< Number of the recorded calls. */
+    uint32_t               Dropped;                     /*!< Calls of the functions not found in the full table. */
+    uint32_t               Overflows;                   /*!< Calls nested deeper than FUNCPROF_STACK_DEPTH. */
+    uint32_t               Depth;                       /*!< Current call depth. */
+    FUNCPROF_Entry_TypeDef Entry[FUNCPROF_NUM_ENTRIES]; /*!< Per-function statistics, hashed by the address. */
+    FUNCPROF_Frame_TypeDef Stack[FUNCPROF_STACK_DEPTH]; /*!< Call stack. */
+} FUNCPROF_Block_TypeDef;
+
+/** @} */ /* End of the group MDR32VF0xI_System_FUNCPROF_Exported_Types */
+
+/** @addtogroup MDR32VF0xI_System_FUNCPROF_Exported_Variables MDR32VF0xI System FUNCPROF Exported Variables
+ * @{
+ */
+
+/**
+ * @brief FUNCPROF statistics block.
+ */
+extern FUNCPROF_Block_TypeDef FUNCPROF_Block;
+
+/** @} */ /* End of the group MDR32VF0xI_System_FUNCPROF_Exported_Variables */
+
+/** @addtogroup MDR32VF0xI_System_FUNCPROF_Exported_Functions MDR32VF0xI System FUNCPROF Exported Functions
+ * @{
+ */
+
+void FUNCPROF_Init(uint32_t ClockFreq);
+void FUNCPROF_Stop(void);
+
+void __cyg_profile_func_enter(void* Func, void* CallSite);
+void __cyg_profile_func_exit(void* Func, void* CallSite);
+
+/** @} */ /* End of the group MDR32VF0xI_System_FUNCPROF_Exported_Functions */
+
+#endif /* USE_FUNCPROF == 1 */
+
+/** @} */ /* End of the group MDR32VF0xI_System_FUNCPROF */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_FUNCPROF_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_funcprof.h */
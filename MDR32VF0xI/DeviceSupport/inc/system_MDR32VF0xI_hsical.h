@@ -0,0 +1,102 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_hsical.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the functions prototypes for the HSI
+ *          calibration (HSICAL).
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_HSICAL_H
+#define SYSTEM_MDR32VF0xI_HSICAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_config.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_HSICAL MDR32VF0xI System HSICAL
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_HSICAL_Exported_Types MDR32VF0xI System HSICAL Exported Types
+ * @{
+ */
+
+/**
+ * @brief HSICAL reference clock.
+ */
+typedef enum {
+    HSICAL_REF_LSE = 0x0, /*!< LSE (LSE_FREQUENCY_Hz). */
+    HSICAL_REF_HSE = 0x1  /*!< HSE divided by 256 (HSE_RTC, HSE_FREQUENCY_Hz / 256). */
+} HSICAL_Ref_TypeDef;
+
+#define IS_HSICAL_REF(REF) (((REF) == HSICAL_REF_LSE) || \
+                            ((REF) == HSICAL_REF_HSE))
+
+/** @} */ /* End of the group MDR32VF0xI_System_HSICAL_Exported_Types */
+
+/** @addtogroup MDR32VF0xI_System_HSICAL_Exported_Defines MDR32VF0xI System HSICAL Exported Defines
+ * @{
+ */
+
+#define HSICAL_TRIM_MAX 0x3FU /*!< Maximum value of the BKP CLK HSI_TRIM field. */
+
+/** @} */ /* End of the group MDR32VF0xI_System_HSICAL_Exported_Defines */
+
+/** @addtogroup MDR32VF0xI_System_HSICAL_Exported_Functions MDR32VF0xI System HSICAL Exported Functions
+ * @{
+ */
+
+uint32_t HSICAL_ComputeFreq(uint32_t Cycles, uint32_t RefTicks, uint32_t RefFreq);
+
+uint32_t HSICAL_GetTrim(void);
+void     HSICAL_SetTrim(uint32_t Trim);
+#if defined(USE_MDR32F02)
+ErrorStatus HSICAL_LoadFactoryTrim(void);
+#endif
+
+uint32_t    HSICAL_Measure(HSICAL_Ref_TypeDef Ref, uint32_t RefTicks);
+ErrorStatus HSICAL_Calibrate(HSICAL_Ref_TypeDef Ref, uint32_t RefTicks);
+
+/** @} */ /* End of the group MDR32VF0xI_System_HSICAL_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_HSICAL */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_HSICAL_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_hsical.h */
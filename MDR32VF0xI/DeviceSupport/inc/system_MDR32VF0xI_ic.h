@@ -0,0 +1,258 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_ic.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains the interrupt controller (IC) abstraction over
+ *          the CLIC (MDR1206) and the PLIC (MDR32F02).
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_IC_H
+#define SYSTEM_MDR32VF0xI_IC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_config.h"
+#include "system_MDR32VF0xI_it.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_IC MDR32VF0xI System IC
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_IC_Exported_Defines MDR32VF0xI System IC Exported Defines
+ * @{
+ */
+
+/**
+ * @brief IC number of interrupt lines.
+ */
+#if defined(USE_MDR1206)
+#define IC_NUM_INTERRUPTS CLIC_NUM_INTERRUPTS
+#elif defined(USE_MDR32F02)
+#define IC_NUM_INTERRUPTS PLIC_NUM_INTERRUPTS
+#endif
+
+/**
+ * @brief IC interrupt priorities.
+ *        IC_PRIORITY_OFF switches the interrupt off, an interrupt of a higher
+ *        priority preempts the handlers of the lower ones (if nesting is supported).
+ *        MDR1206: priority P is the CLIC INTxCTL value (P << 5) | 0x1F,
+ *                 the CLIC level is the upper NLBITS bits of this value
+ *                 and the unimplemented level bits read as 1, so even P = 0
+ *                 is a non-zero level preempting the thread code:
+ *                 IC_SetPriorityIRQ clears the interrupt enable bit instead;
+ *        MDR32F02: priority P is the PLIC source priority, 0 never interrupts.
+ */
+#define IC_PRIORITY_OFF     0U
+#define IC_PRIORITY_LOWEST  1U
+#define IC_PRIORITY_HIGHEST 7U
+
+#define IS_IC_PRIORITY(PRIORITY) ((PRIORITY) <= IC_PRIORITY_HIGHEST)
+
+#if defined(USE_MDR1206)
+#define IC_PRIORITY_TO_CTL(PRIORITY) ((uint8_t)(((PRIORITY) << 5) | 0x1FU))
+#endif
+
+/** @} */ /* End of the group MDR32VF0xI_System_IC_Exported_Defines */
+
+/** @addtogroup MDR32VF0xI_System_IC_Exported_Variables MDR32VF0xI System IC Exported Variables
+ * @{
+ */
+
+/**
+ * @brief IC per-interrupt context pointers.
+ */
+extern void* IC_ContextTable[IC_NUM_INTERRUPTS];
+
+/** @} */ /* End of the group MDR32VF0xI_System_IC_Exported_Variables */
+
+/** @addtogroup MDR32VF0xI_System_IC_Exported_Functions MDR32VF0xI System IC Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Enable an interrupt in the interrupt controller.
+ * @param  IRQn: Device specific interrupt number.
+ * @return None.
+ */
+__STATIC_FORCEINLINE void IC_EnableIRQ(IRQn_TypeDef IRQn)
+{
+#if defined(USE_MDR1206)
+    CLIC->INT[IRQn].IE = 1;
+#elif defined(USE_MDR32F02)
+    PLIC_WRITE_REG(PLIC_IEB + (((uint32_t)IRQn + 1) / 32) * 4,
+                   PLIC_READ_REG(PLIC_IEB + (((uint32_t)IRQn + 1) / 32) * 4) | (1UL << (((uint32_t)IRQn + 1) % 32)));
+#endif
+}
+
+/**
+ * @brief  Disable an interrupt in the interrupt controller.
+ * @param  IRQn: Device specific interrupt number.
+ * @return None.
+ */
+__STATIC_FORCEINLINE void IC_DisableIRQ(IRQn_TypeDef IRQn)
+{
+#if defined(USE_MDR1206)
+    CLIC->INT[IRQn].IE = 0;
+#elif defined(USE_MDR32F02)
+    PLIC_WRITE_REG(PLIC_IEB + (((uint32_t)IRQn + 1) / 32) * 4,
+                   PLIC_READ_REG(PLIC_IEB + (((uint32_t)IRQn + 1) / 32) * 4) & ~(1UL << (((uint32_t)IRQn + 1) % 32)));
+#endif
+}
+
+/**
+ * @brief  Get the interrupt pending status.
+ * @param  IRQn: Device specific interrupt number.
+ * @return @ref FlagStatus - SET if the interrupt is pending.
+ */
+__STATIC_FORCEINLINE FlagStatus IC_GetPendingIRQ(IRQn_TypeDef IRQn)
+{
+#if defined(USE_MDR1206)
+    return (CLIC->INT[IRQn].IP != 0) ? SET : RESET;
+#elif defined(USE_MDR32F02)
+    return ((PLIC_READ_REG(PLIC_IPB + (((uint32_t)IRQn + 1) / 32) * 4) >> (((uint32_t)IRQn + 1) % 32)) & 1UL) ? SET : RESET;
+#endif
+}
+
+/**
+ * @brief  Set the interrupt priority.
+ * @note   On MDR1206 the interrupt level and the CLIC priority are both
+ *         derived from Priority, so the ordering is the same on both MCUs.
+ *         IC_PRIORITY_OFF also disables the interrupt on MDR1206 (the CLIC has
+ *         no level that never interrupts), it is enabled again by IC_EnableIRQ
+ *         after a higher priority is set.
+ * @param  IRQn: Device specific interrupt number.
+ * @param  Priority: Interrupt priority, from IC_PRIORITY_OFF to IC_PRIORITY_HIGHEST.
+ * @return None.
+ */
+__STATIC_FORCEINLINE void IC_SetPriorityIRQ(IRQn_TypeDef IRQn, uint32_t Priority)
+{
+#if defined(USE_MDR1206)
+    if (Priority == IC_PRIORITY_OFF) {
+        CLIC->INT[IRQn].IE = 0;
+    }
+    CLIC->INT[IRQn].CTL = IC_PRIORITY_TO_CTL(Priority);
+#elif defined(USE_MDR32F02)
+    PLIC_WRITE_REG(PLIC_ISP((uint32_t)IRQn), Priority);
+#endif
+}
+
+/**
+ * @brief  Set the priority threshold: only the interrupts of higher
+ *         priorities are taken.
+ * @param  Priority: Threshold priority, IC_PRIORITY_OFF enables all.
+ * @return None.
+ */
+__STATIC_FORCEINLINE void IC_SetThreshold(uint32_t Priority)
+{
+#if defined(USE_MDR1206)
+    csr_write(CSR_MINTTHRESH, (Priority != IC_PRIORITY_OFF) ? IC_PRIORITY_TO_CTL(Priority) : 0);
+#elif defined(USE_MDR32F02)
+    PLIC_WRITE_REG(PLIC_PTHR, Priority);
+#endif
+}
+
+/**
+ * @brief  Global enable interrupts for machine privilege mode.
+ * @param  None.
+ * @return None.
+ */
+__STATIC_FORCEINLINE void IC_GlobalEnableIRQ(void)
+{
+    csr_set_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+}
+
+/**
+ * @brief  Global disable interrupts for machine privilege mode.
+ * @param  None.
+ * @return None.
+ */
+__STATIC_FORCEINLINE void IC_GlobalDisableIRQ(void)
+{
+    csr_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+}
+
+/**
+ * @brief  Enter a critical section: disable interrupts for machine
+ *         privilege mode and return the previous state.
+ * @param  None.
+ * @return State to be passed to IC_ExitCritical.
+ */
+__STATIC_FORCEINLINE uint_xlen_t IC_EnterCritical(void)
+{
+    return csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE) & CSR_MSTATUS_MIE;
+}
+
+/**
+ * @brief  Exit a critical section entered by IC_EnterCritical.
+ * @param  State: Value returned by IC_EnterCritical.
+ * @return None.
+ */
+__STATIC_FORCEINLINE void IC_ExitCritical(uint_xlen_t State)
+{
+    csr_set_bits(CSR_MSTATUS, State);
+}
+
+/**
+ * @brief  Set the context pointer of an interrupt.
+ * @param  IRQn: Device specific interrupt number.
+ * @param  Context: Driver defined context.
+ * @return None.
+ */
+__STATIC_FORCEINLINE void IC_SetContext(IRQn_TypeDef IRQn, void* Context)
+{
+    IC_ContextTable[IRQn] = Context;
+}
+
+/**
+ * @brief  Get the context pointer of an interrupt.
+ * @param  IRQn: Device specific interrupt number.
+ * @return Driver defined context.
+ */
+__STATIC_FORCEINLINE void* IC_GetContext(IRQn_TypeDef IRQn)
+{
+    return IC_ContextTable[IRQn];
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_IC_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_IC */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_IC_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_ic.h */
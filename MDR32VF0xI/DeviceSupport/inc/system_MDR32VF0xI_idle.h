@@ -0,0 +1,102 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_idle.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the functions prototypes for the tickless
+ *          idle manager (IDLE).
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_IDLE_H
+#define SYSTEM_MDR32VF0xI_IDLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include "system_MDR32VF0xI_config.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_IDLE MDR32VF0xI System IDLE
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_IDLE_Exported_Types MDR32VF0xI System IDLE Exported Types
+ * @{
+ */
+
+/**
+ * @brief IDLE low-power sleep function, for example, the BKP RTC wakeup timer
+ *        with the core clock switched off.
+ * @note  Called with the interrupts disabled. Should program the wakeup not later
+ *        than MaxTicks, enter the low-power mode and return after the wakeup
+ *        (by the timer or by any other interrupt).
+ * @param MaxTicks: Time to the next software timer deadline [MTIME ticks].
+ * @return Time spent in the low-power mode measured by the low-power timer [MTIME ticks].
+ */
+typedef uint64_t (*IDLE_SleepFunc_TypeDef)(uint64_t MaxTicks);
+
+/**
+ * @brief IDLE statistics.
+ */
+typedef struct {
+    uint64_t IdleTicks;  /*!< Time spent in IDLE_Enter [MTIME ticks], including the low-power sleep. */
+    uint64_t SleepTicks; /*!< Time spent in the low-power sleep function [MTIME ticks]. */
+    uint32_t WFICount;   /*!< Number of the WFI idle periods. */
+    uint32_t SleepCount; /*!< Number of the low-power sleep periods. */
+} IDLE_Stats_TypeDef;
+
+/** @} */ /* End of the group MDR32VF0xI_System_IDLE_Exported_Types */
+
+/** @addtogroup MDR32VF0xI_System_IDLE_Exported_Functions MDR32VF0xI System IDLE Exported Functions
+ * @{
+ */
+
+void IDLE_Init(void);
+void IDLE_SetSleepFunc(IDLE_SleepFunc_TypeDef SleepFunc, uint64_t MinTicks);
+
+void IDLE_Enter(void);
+
+void     IDLE_GetStats(IDLE_Stats_TypeDef* Stats);
+uint32_t IDLE_GetLoad(void);
+
+/** @} */ /* End of the group MDR32VF0xI_System_IDLE_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_IDLE */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_IDLE_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_idle.h */
@@ -0,0 +1,123 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_irqmod.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the functions prototypes for the adaptive
+ *          interrupt moderation (IRQMOD) firmware library.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_IRQMOD_H
+#define SYSTEM_MDR32VF0xI_IRQMOD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include "system_MDR32VF0xI_config.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_IRQMOD MDR32VF0xI System IRQMOD
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_IRQMOD_Exported_Types MDR32VF0xI System IRQMOD Exported Types
+ * @{
+ */
+
+/**
+ * @brief IRQMOD source service mode.
+ */
+typedef enum {
+    IRQMOD_MODE_IRQ  = 0x0, /*!< The source is serviced by its interrupt handler. */
+    IRQMOD_MODE_POLL = 0x1  /*!< The source interrupt is disabled, the source is polled by IRQMOD_Poll. */
+} IRQMOD_Mode_TypeDef;
+
+/**
+ * @brief IRQMOD poll function.
+ * @param Arg: Argument given in IRQMOD_InitSource.
+ * @return Number of the events serviced by the call.
+ */
+typedef uint32_t (*IRQMOD_PollFunc_TypeDef)(void* Arg);
+
+/**
+ * @brief IRQMOD source statistics.
+ */
+typedef struct {
+    uint32_t IRQEvents;   /*!< Number of the interrupts counted by IRQMOD_CountIRQ. */
+    uint32_t PollEvents;  /*!< Number of the events serviced by the poll function. */
+    uint32_t ToPolling;   /*!< Number of the transitions from the interrupt to the polling mode. */
+    uint32_t ToInterrupt; /*!< Number of the transitions from the polling to the interrupt mode. */
+} IRQMOD_Stats_TypeDef;
+
+/**
+ * @brief IRQMOD source control block.
+ */
+typedef struct IRQMOD_Source_Struct {
+    IRQn_TypeDef                 IRQn;          /*!< Moderated interrupt. */
+    uint32_t                     HighThreshold; /*!< Events per window to switch to the polling mode. */
+    uint32_t                     LowThreshold;  /*!< Events per window to return to the interrupt mode. */
+    IRQMOD_PollFunc_TypeDef      PollFunc;      /*!< Source service function for the polling mode. */
+    void*                        Arg;           /*!< Poll function argument. */
+    volatile IRQMOD_Mode_TypeDef Mode;          /*!< Current service mode. */
+    uint32_t                     WindowStart;   /*!< MTIME (lower 32 bits) of the current window start. */
+    uint32_t                     WindowEvents;  /*!< Events counted in the current window. */
+    IRQMOD_Stats_TypeDef         Stats;         /*!< Source statistics. */
+    struct IRQMOD_Source_Struct* Next;          /*!< Next registered source. */
+} IRQMOD_Source_TypeDef;
+
+/** @} */ /* End of the group MDR32VF0xI_System_IRQMOD_Exported_Types */
+
+/** @addtogroup MDR32VF0xI_System_IRQMOD_Exported_Functions MDR32VF0xI System IRQMOD Exported Functions
+ * @{
+ */
+
+void IRQMOD_Init(uint32_t WindowTicks);
+void IRQMOD_InitSource(IRQMOD_Source_TypeDef* Source, IRQn_TypeDef IRQn, uint32_t HighThreshold, uint32_t LowThreshold,
+                       IRQMOD_PollFunc_TypeDef PollFunc, void* Arg);
+
+IRQMOD_Mode_TypeDef IRQMOD_CountIRQ(IRQMOD_Source_TypeDef* Source);
+void                IRQMOD_Poll(void);
+
+void IRQMOD_GetStats(const IRQMOD_Source_TypeDef* Source, IRQMOD_Stats_TypeDef* Stats);
+
+/** @} */ /* End of the group MDR32VF0xI_System_IRQMOD_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_IRQMOD */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_IRQMOD_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_irqmod.h */
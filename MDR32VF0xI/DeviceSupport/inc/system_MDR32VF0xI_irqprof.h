@@ -0,0 +1,181 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_irqprof.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the functions prototypes for the interrupt
+ *          latency and duration profiler (IRQPROF).
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_IRQPROF_H
+#define SYSTEM_MDR32VF0xI_IRQPROF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_config.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_IRQPROF MDR32VF0xI System IRQPROF
+ * @{
+ */
+
+#if (IT_USE_PROFILE == 1)
+
+/** @addtogroup MDR32VF0xI_System_IRQPROF_Exported_Defines MDR32VF0xI System IRQPROF Exported Defines
+ * @{
+ */
+
+/**
+ * @brief IRQPROF block identification, checked by IRQPROF_Init and the host decoder
+ *        (MDR32VF0xI/Tools/irqprof_decode.py).
+ */
+#define IRQPROF_MAGIC   0x46525049UL /* "IPRF" */
+#define IRQPROF_VERSION 1U
+
+/**
+ * @brief IRQPROF number of the log2 histogram bins.
+ *        Bin 0 counts the value 0, bin K counts the values from 2^(K-1) to 2^K - 1,
+ *        the last bin also counts all the larger values.
+ */
+#define IRQPROF_HIST_BINS 16U
+
+/**
+ * @brief IRQPROF statistics entries.
+ *        MDR1206: the entry index is the CLIC interrupt number (MCAUSE exception code);
+ *        MDR32F02: the entry index is the MCAUSE exception code for the local
+ *                  interrupts (MSIP, MTIP) and IRQPROF_EXT_OFFSET + IRQn for
+ *                  the external (PLIC) interrupts.
+ */
+#if defined(USE_MDR1206)
+#define IRQPROF_EXT_OFFSET  0U
+#define IRQPROF_NUM_ENTRIES CLIC_NUM_INTERRUPTS
+#elif defined(USE_MDR32F02)
+#define IRQPROF_EXT_OFFSET  8U
+#define IRQPROF_NUM_ENTRIES (IRQPROF_EXT_OFFSET + PLIC_NUM_INTERRUPTS)
+#endif
+
+#define IS_IRQPROF_INDEX(INDEX) ((INDEX) < IRQPROF_NUM_ENTRIES)
+
+/** @} */ /* End of the group MDR32VF0xI_System_IRQPROF_Exported_Defines */
+
+/** @addtogroup MDR32VF0xI_System_IRQPROF_Exported_Types MDR32VF0xI System IRQPROF Exported Types
+ * @{
+ */
+
+/**
+ * @brief IRQPROF per-interrupt statistics.
+ * @note  Latency is the time from the trap dispatcher entry to the handler call,
+ *        it includes the handlers of the other interrupts claimed in the same trap.
+ *        Duration is the time of the handler call, it includes the handlers
+ *        of the nested interrupts. Both are in the time stamp clock units.
+ *        The histogram counters saturate at 0xFFFF.
+ */
+typedef struct {
+    uint32_t Count;                           /*!< Number of the handler calls. */
+    uint32_t LatencyMin;                      /*!< Minimum latency, 0xFFFFFFFF if Count is 0. */
+    uint32_t LatencyMax;                      /*!< Maximum latency. */
+    uint32_t DurationMin;                     /*!< Minimum duration, 0xFFFFFFFF if Count is 0. */
+    uint32_t DurationMax;                     /*!< Maximum duration. */
+    uint16_t LatencyHist[IRQPROF_HIST_BINS];  /*!< Latency log2 histogram. */
+    uint16_t DurationHist[IRQPROF_HIST_BINS]; /*!< Duration log2 histogram. */
+} IRQPROF_Entry_TypeDef;
+
+/**
+ * @brief IRQPROF statistics block, placed in the .noinit section so that it can be
+ *        read from a memory dump after a warm reset.
+ * @note  The layout is decoded by MDR32VF0xI/Tools/irqprof_decode.py,
+ *        IRQPROF_VERSION should be changed with it.
+ */
+typedef struct {
+    uint32_t              Magic;                      /*!< IRQPROF_MAGIC if the block is valid. */
+    uint16_t              Version;                    /*!< IRQPROF_VERSION. */
+    uint8_t               NumEntries;                 /*!< IRQPROF_NUM_ENTRIES. */
+    uint8_t               HistBins;                   /*!< IRQPROF_HIST_BINS. */
+    uint8_t               Clock;                      /*!< Time stamp source, IT_PROFILE_CLOCK. */
+    uint8_t               ExtOffset;                  /*!< IRQPROF_EXT_OFFSET. */
+    uint16_t              Reserved;                   /*!< Reserved, zero. */
+    uint32_t              ClockFreq;                  /*!< Time stamp clock frequency [Hz]. */
+    IRQPROF_Entry_TypeDef Entry[IRQPROF_NUM_ENTRIES]; /*!< Per-interrupt statistics. */
+} IRQPROF_Block_TypeDef;
+
+/** @} */ /* End of the group MDR32VF0xI_System_IRQPROF_Exported_Types */
+
+/** @addtogroup MDR32VF0xI_System_IRQPROF_Exported_Variables MDR32VF0xI System IRQPROF Exported Variables
+ * @{
+ */
+
+/**
+ * @brief IRQPROF statistics block.
+ */
+extern IRQPROF_Block_TypeDef IRQPROF_Block;
+
+/** @} */ /* End of the group MDR32VF0xI_System_IRQPROF_Exported_Variables */
+
+/** @addtogroup MDR32VF0xI_System_IRQPROF_Exported_Functions MDR32VF0xI System IRQPROF Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Get the IRQPROF time stamp.
+ * @param  None.
+ * @return MCYCLE or MTIME (IT_PROFILE_CLOCK) lower 32 bits.
+ */
+__STATIC_FORCEINLINE uint32_t IRQPROF_GetTime(void)
+{
+#if (IT_PROFILE_CLOCK == 0)
+    return (uint32_t)csr_read(CSR_MCYCLE);
+#else
+    return *(volatile uint32_t*)(MTIME_BASE);
+#endif
+}
+
+void IRQPROF_Init(uint32_t ClockFreq);
+void IRQPROF_Reset(void);
+
+void IRQPROF_Record(uint32_t Index, uint32_t EntryTime, uint32_t StartTime, uint32_t EndTime);
+
+const IRQPROF_Entry_TypeDef* IRQPROF_GetEntry(uint32_t Index);
+
+/** @} */ /* End of the group MDR32VF0xI_System_IRQPROF_Exported_Functions */
+
+#endif /* IT_USE_PROFILE == 1 */
+
+/** @} */ /* End of the group MDR32VF0xI_System_IRQPROF */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_IRQPROF_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_irqprof.h */
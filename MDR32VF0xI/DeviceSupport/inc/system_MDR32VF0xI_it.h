@@ -29,6 +29,7 @@ extern "C" {
 #endif
 
 /* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
 #include "system_MDR32VF0xI_config.h"
 
 /** @addtogroup DEVICE_SUPPORT Device Support
@@ -60,6 +61,21 @@ typedef enum {
                                         ((MODE) == IT_PRIVILEGE_MODE_IRQ_U))
 #endif
 
+#if (IT_USE_HANDLER_TABLE == 1)
+/**
+ * @brief IT interrupt handler with context.
+ */
+typedef void (*IT_ContextHandler_TypeDef)(void* Context);
+
+/**
+ * @brief IT handler table entry.
+ */
+typedef struct {
+    IT_ContextHandler_TypeDef Handler; /*!< Handler, NULL if the vector table handler is used. */
+    void*                     Context; /*!< Handler context. */
+} IT_HandlerEntry_TypeDef;
+#endif
+
 /** @} */ /* End of the group MDR32VF0xI_System_IT_Exported_Types */
 
 /** @addtogroup MDR32VF0xI_System_IT_Exported_Defines MDR32VF0xI System IT Exported Defines
@@ -111,6 +127,29 @@ typedef enum {
 #define CSR_USTATUS_UPIE     CSR_USTATUS_UPIE_Msk
 #endif
 
+/**
+ *  @brief IT number of the handler table entries (indexed by IRQn).
+ */
+#if defined(USE_MDR32F02)
+#define IT_NUM_HANDLERS PLIC_NUM_INTERRUPTS
+#elif defined(USE_MDR1206)
+#define IT_NUM_HANDLERS CLIC_NUM_INTERRUPTS
+#endif
+
+/**
+ *  @brief IT interrupt stack canary pattern.
+ */
+#define IT_STACK_CANARY ((uint32_t)0x5AA5C33C)
+
+/**
+ *  @brief IT trap vector installed by SystemInit.
+ */
+#if (USE_IT_STACK == 1) || (IT_USE_FAST_TRAP == 1) || (IT_USE_MISALIGN_EMU == 1)
+#define IT_TRAP_VECTOR Trap_IRQEntry
+#else
+#define IT_TRAP_VECTOR Trap_IRQHandler
+#endif
+
 /** @} */ /* End of the group MDR32VF0xI_System_IT_Exported_Defines */
 
 /** @addtogroup MDR32VF0xI_System_IT_Exported_Variables MDR32VF0xI System IT Exported Variables
@@ -138,6 +177,14 @@ extern __VECTOR_TABLE_ALIGNED IRQHandler_TypeDef InterruptVectorTable[];
 extern IRQHandler_TypeDef ExtInterruptVectorTable[];
 #endif
 
+#if (IT_USE_HANDLER_TABLE == 1)
+/**
+ * @brief IT handler table with contexts indexed by IRQn. The registered handler
+ *        gets the context of its entry, IC_ContextTable serves the vector table handlers.
+ */
+extern IT_HandlerEntry_TypeDef IT_HandlerTable[IT_NUM_HANDLERS];
+#endif
+
 /** @} */ /* End of the group MDR32VF0xI_System_IT_Exported_Variables */
 
 /** @addtogroup MDR32VF0xI_System_IT_Exported_Functions MDR32VF0xI System IT Exported Functions
@@ -154,6 +201,19 @@ void       IT_GlobalDisableIRQ(IT_PrivilegeModeIRQ_TypeDef PrivilegeMode);
 FlagStatus IT_GetGlobalEnableIRQ(IT_PrivilegeModeIRQ_TypeDef PrivilegeMode);
 #endif
 
+void IT_TrapDispatch(uint_xlen_t MCause);
+
+#if (IT_USE_HANDLER_TABLE == 1)
+void IT_RegisterHandler(IRQn_TypeDef IRQn, IT_ContextHandler_TypeDef Handler, void* Context);
+void IT_UnregisterHandler(IRQn_TypeDef IRQn);
+#endif
+
+#if (USE_IT_STACK == 1)
+void        IT_InitStack(void);
+ErrorStatus IT_CheckStack(void);
+uint32_t    IT_GetStackUsage(void);
+#endif
+
 /** @} */ /* End of the group MDR32VF0xI_System_IT_Exported_Functions */
 
 /** @addtogroup MDR32VF0xI_System_IT_Exported_IRQ_Handlers MDR32VF0xI System IT Exported IRQ Handlers
@@ -169,6 +229,15 @@ __WEAK __INTERRUPT_MACHINE void Trap_IRQHandler(void);
 __WEAK __INTERRUPT_MACHINE __TRAP_HANDLER_ALIGNED void Trap_IRQHandler(void);
 #endif
 
+#if (USE_IT_STACK == 1) || (IT_USE_FAST_TRAP == 1) || (IT_USE_MISALIGN_EMU == 1)
+/**
+ * @brief IT trap entry (startup file): switches to the interrupt stack if
+ *        USE_IT_STACK is 1, dispatches through the vector tables if IT_USE_FAST_TRAP is 1,
+ *        emulates the misaligned loads and stores if IT_USE_MISALIGN_EMU is 1.
+ */
+void Trap_IRQEntry(void);
+#endif
+
 /**
  * @brief IT interrupt handlers.
  */
@@ -0,0 +1,123 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_misalign.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the functions prototypes for the misaligned
+ *          load and store emulation (MISALIGN).
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_MISALIGN_H
+#define SYSTEM_MDR32VF0xI_MISALIGN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_config.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_MISALIGN MDR32VF0xI System MISALIGN
+ * @{
+ */
+
+#if (IT_USE_MISALIGN_EMU == 1)
+
+/** @addtogroup MDR32VF0xI_System_MISALIGN_Exported_Types MDR32VF0xI System MISALIGN Exported Types
+ * @{
+ */
+
+/**
+ * @brief MISALIGN memory access type.
+ */
+typedef enum {
+    MISALIGN_ACCESS_LOAD  = 0x0, /*!< Load (LB, LH, LW, LBU, LHU, C.LW, C.LWSP). */
+    MISALIGN_ACCESS_STORE = 0x1  /*!< Store (SB, SH, SW, C.SW, C.SWSP). */
+} MISALIGN_Access_TypeDef;
+
+/**
+ * @brief MISALIGN decoded load or store instruction.
+ */
+typedef struct {
+    MISALIGN_Access_TypeDef Access;     /*!< Memory access type. */
+    uint8_t                 Size;       /*!< Access size [bytes]: 1, 2 or 4. */
+    uint8_t                 SignExtend; /*!< 1 if the loaded value is sign-extended (LB, LH, LW), 0 otherwise. */
+    uint8_t                 Reg;        /*!< Destination register (load) or source register (store), x0..x31. */
+    uint8_t                 BaseReg;    /*!< Base address register, x0..x31. */
+    uint8_t                 Length;     /*!< Instruction length [bytes]: 2 (compressed) or 4. */
+    int32_t                 Offset;     /*!< Address offset added to the base register. */
+} MISALIGN_Instr_TypeDef;
+
+/**
+ * @brief MISALIGN faulting instruction counter.
+ */
+typedef struct {
+    uint_xlen_t PC;    /*!< Address of the faulting instruction. */
+    uint32_t    Count; /*!< Number of the emulated accesses, 0 if the entry is free. */
+} MISALIGN_PCEntry_TypeDef;
+
+/**
+ * @brief MISALIGN statistics.
+ */
+typedef struct {
+    uint32_t                 Loads;                   /*!< Number of the emulated loads. */
+    uint32_t                 Stores;                  /*!< Number of the emulated stores. */
+    uint32_t                 Unsupported;             /*!< Number of the exceptions passed to TrapLAM/TrapSAM handlers. */
+    uint32_t                 Untracked;               /*!< Number of the emulated accesses not counted per PC (table full). */
+    MISALIGN_PCEntry_TypeDef PC[IT_MISALIGN_NUM_PCS]; /*!< Per-PC counters in the order of the first occurrence. */
+} MISALIGN_Stats_TypeDef;
+
+/** @} */ /* End of the group MDR32VF0xI_System_MISALIGN_Exported_Types */
+
+/** @addtogroup MDR32VF0xI_System_MISALIGN_Exported_Functions MDR32VF0xI System MISALIGN Exported Functions
+ * @{
+ */
+
+ErrorStatus MISALIGN_Decode(uint32_t Instr, MISALIGN_Instr_TypeDef* Decoded);
+
+uint_xlen_t MISALIGN_Emulate(uint_xlen_t* Regs, uint_xlen_t MEpc, uint_xlen_t MCause);
+
+const MISALIGN_Stats_TypeDef* MISALIGN_GetStats(void);
+void                          MISALIGN_ResetStats(void);
+
+/** @} */ /* End of the group MDR32VF0xI_System_MISALIGN_Exported_Functions */
+
+#endif /* IT_USE_MISALIGN_EMU == 1 */
+
+/** @} */ /* End of the group MDR32VF0xI_System_MISALIGN */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_MISALIGN_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_misalign.h */
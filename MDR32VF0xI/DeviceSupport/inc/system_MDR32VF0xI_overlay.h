@@ -0,0 +1,129 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_overlay.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the functions prototypes for the code
+ *          overlay loader (OVERLAY).
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_OVERLAY_H
+#define SYSTEM_MDR32VF0xI_OVERLAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_config.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_OVERLAY MDR32VF0xI System OVERLAY
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_OVERLAY_Exported_Defines MDR32VF0xI System OVERLAY Exported Defines
+ * @{
+ */
+
+/**
+ * @brief OVERLAY number of the overlays, the .overlayN sections and
+ *        the __overlay_table descriptors of the linker scripts.
+ */
+#define OVERLAY_NUM 4U
+
+/**
+ * @brief OVERLAY_Resident value if no overlay is resident.
+ */
+#define OVERLAY_NONE 0xFFFFFFFFUL
+
+#define IS_OVERLAY(OVERLAY) ((OVERLAY) < OVERLAY_NUM)
+
+/** @} */ /* End of the group MDR32VF0xI_System_OVERLAY_Exported_Defines */
+
+/** @addtogroup MDR32VF0xI_System_OVERLAY_Exported_Types MDR32VF0xI System OVERLAY Exported Types
+ * @{
+ */
+
+/**
+ * @brief OVERLAY descriptor of the linker script __overlay_table.
+ */
+typedef struct {
+    uint32_t Load;  /*!< Load image address in REGION_LOAD. */
+    uint32_t Start; /*!< Execution start address in REGION_RAMFUNC, the same for all the overlays. */
+    uint32_t End;   /*!< Execution end address. */
+} OVERLAY_Descriptor_TypeDef;
+
+/** @} */ /* End of the group MDR32VF0xI_System_OVERLAY_Exported_Types */
+
+/** @addtogroup MDR32VF0xI_System_OVERLAY_Exported_Variables MDR32VF0xI System OVERLAY Exported Variables
+ * @{
+ */
+
+/**
+ * @brief OVERLAY number of the resident overlay, OVERLAY_NONE after reset.
+ */
+extern uint32_t OVERLAY_Resident;
+
+/** @} */ /* End of the group MDR32VF0xI_System_OVERLAY_Exported_Variables */
+
+/** @addtogroup MDR32VF0xI_System_OVERLAY_Exported_Functions MDR32VF0xI System OVERLAY Exported Functions
+ * @{
+ */
+
+void OVERLAY_Load(uint32_t Overlay);
+
+/**
+ * @brief  Make an overlay resident before calling its functions (__OVERLAY(N)).
+ * @note   The check is inlined at the call site, so a call into the resident
+ *         overlay costs one load and one branch. The overlay functions should
+ *         not be called from the interrupt handlers unless the handlers check
+ *         OVERLAY_Resident.
+ * @param  Overlay: Overlay number, less than OVERLAY_NUM.
+ * @return None.
+ */
+__STATIC_FORCEINLINE void OVERLAY_Enter(uint32_t Overlay)
+{
+    if (OVERLAY_Resident != Overlay) {
+        OVERLAY_Load(Overlay);
+    }
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_OVERLAY_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_OVERLAY */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_OVERLAY_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_overlay.h */
@@ -0,0 +1,107 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_pheap.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the functions prototypes for the intrusive
+ *          pairing heap (PHEAP).
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_PHEAP_H
+#define SYSTEM_MDR32VF0xI_PHEAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include "system_MDR32VF0xI_config.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_PHEAP MDR32VF0xI System PHEAP
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_PHEAP_Exported_Types MDR32VF0xI System PHEAP Exported Types
+ * @{
+ */
+
+/**
+ * @brief PHEAP node, embedded into the element kept in the heap.
+ */
+typedef struct PHEAP_Node_Struct {
+    uint64_t                  Key;   /*!< Node key, the heap root has the smallest key. */
+    struct PHEAP_Node_Struct* Child; /*!< First child. */
+    struct PHEAP_Node_Struct* Next;  /*!< Next sibling. */
+    struct PHEAP_Node_Struct* Prev;  /*!< Previous sibling, the parent for the first child, NULL for the root. */
+} PHEAP_Node_TypeDef;
+
+/**
+ * @brief PHEAP heap.
+ */
+typedef struct {
+    PHEAP_Node_TypeDef* Root; /*!< Node with the smallest key, NULL if the heap is empty. */
+} PHEAP_TypeDef;
+
+/** @} */ /* End of the group MDR32VF0xI_System_PHEAP_Exported_Types */
+
+/** @addtogroup MDR32VF0xI_System_PHEAP_Exported_Functions MDR32VF0xI System PHEAP Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Get the node with the smallest key.
+ * @param  Heap: Pointer to the heap.
+ * @return Pointer to the node, NULL if the heap is empty.
+ */
+__STATIC_INLINE PHEAP_Node_TypeDef* PHEAP_GetMin(const PHEAP_TypeDef* Heap)
+{
+    return Heap->Root;
+}
+
+void PHEAP_Init(PHEAP_TypeDef* Heap);
+
+void PHEAP_Insert(PHEAP_TypeDef* Heap, PHEAP_Node_TypeDef* Node);
+void PHEAP_Remove(PHEAP_TypeDef* Heap, PHEAP_Node_TypeDef* Node);
+
+PHEAP_Node_TypeDef* PHEAP_PopMin(PHEAP_TypeDef* Heap);
+
+/** @} */ /* End of the group MDR32VF0xI_System_PHEAP_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_PHEAP */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_PHEAP_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_pheap.h */
@@ -0,0 +1,125 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_swtimer.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the functions prototypes for the tickless
+ *          software timers (SWTIMER) on the machine timer.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_SWTIMER_H
+#define SYSTEM_MDR32VF0xI_SWTIMER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_pheap.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_SWTIMER MDR32VF0xI System SWTIMER
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_SWTIMER_Exported_Defines MDR32VF0xI System SWTIMER Exported Defines
+ * @{
+ */
+
+/**
+ * @brief SWTIMER deadline returned by SWTIMER_GetNextDeadline if no timer is active,
+ *        also the machine timer compare value programmed in this case.
+ */
+#define SWTIMER_NO_DEADLINE 0xFFFFFFFFFFFFFFFFULL
+
+/** @} */ /* End of the group MDR32VF0xI_System_SWTIMER_Exported_Defines */
+
+/** @addtogroup MDR32VF0xI_System_SWTIMER_Exported_Types MDR32VF0xI System SWTIMER Exported Types
+ * @{
+ */
+
+/**
+ * @brief SWTIMER expiration callback, called from SWTIMER_Process.
+ * @param Context: Context given in SWTIMER_Create.
+ */
+typedef void (*SWTIMER_Callback_TypeDef)(void* Context);
+
+/**
+ * @brief SWTIMER timer.
+ */
+typedef struct {
+    PHEAP_Node_TypeDef       Node;     /*!< Deadline heap node, Node.Key is the deadline (MTIME). Should be the first member. */
+    uint32_t                 Period;   /*!< Reload period [MTIME ticks], 0 for a one-shot timer. */
+    SWTIMER_Callback_TypeDef Callback; /*!< Expiration callback. */
+    void*                    Context;  /*!< Callback context. */
+    volatile uint8_t         Active;   /*!< 1 if the timer is in the deadline heap. */
+} SWTIMER_TypeDef;
+
+/** @} */ /* End of the group MDR32VF0xI_System_SWTIMER_Exported_Types */
+
+/** @addtogroup MDR32VF0xI_System_SWTIMER_Exported_Functions MDR32VF0xI System SWTIMER Exported Functions
+ * @{
+ */
+
+void SWTIMER_Init(void);
+void SWTIMER_Create(SWTIMER_TypeDef* Timer, SWTIMER_Callback_TypeDef Callback, void* Context);
+
+void SWTIMER_Start(SWTIMER_TypeDef* Timer, uint32_t Delay, uint32_t Period);
+void SWTIMER_StartAt(SWTIMER_TypeDef* Timer, uint64_t Deadline, uint32_t Period);
+void SWTIMER_Stop(SWTIMER_TypeDef* Timer);
+
+FlagStatus SWTIMER_IsActive(const SWTIMER_TypeDef* Timer);
+uint64_t   SWTIMER_GetNextDeadline(void);
+
+void SWTIMER_Process(void);
+
+void SWTIMER_Rescale(uint32_t OldTickFreq, uint32_t NewTickFreq);
+
+/** @} */ /* End of the group MDR32VF0xI_System_SWTIMER_Exported_Functions */
+
+#if (SWTIMER_USE_MTIP == 1)
+/** @addtogroup MDR32VF0xI_System_SWTIMER_Exported_IRQ_Handlers MDR32VF0xI System SWTIMER Exported IRQ Handlers
+ * @{
+ */
+
+void MTIP_IRQHandler(void);
+
+/** @} */ /* End of the group MDR32VF0xI_System_SWTIMER_Exported_IRQ_Handlers */
+#endif
+
+/** @} */ /* End of the group MDR32VF0xI_System_SWTIMER */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_SWTIMER_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_swtimer.h */
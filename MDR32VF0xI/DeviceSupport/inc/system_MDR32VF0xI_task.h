@@ -0,0 +1,123 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_task.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the functions prototypes for the
+ *          run-to-completion task (TASK) firmware library.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_TASK_H
+#define SYSTEM_MDR32VF0xI_TASK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include "system_MDR32VF0xI_config.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_TASK MDR32VF0xI System TASK
+ * @{
+ */
+
+#if defined(USE_MDR1206)
+
+/** @addtogroup MDR32VF0xI_System_TASK_Exported_Types MDR32VF0xI System TASK Exported Types
+ * @{
+ */
+
+/**
+ * @brief TASK event.
+ */
+typedef struct {
+    uint32_t Signal; /*!< Application defined event signal. */
+    void*    Param;  /*!< Application defined event parameter. */
+} TASK_Event_TypeDef;
+
+/**
+ * @brief TASK event handler. Runs to completion at the task level.
+ */
+typedef void (*TASK_Handler_TypeDef)(const TASK_Event_TypeDef* Event);
+
+/**
+ * @brief TASK control block.
+ */
+typedef struct {
+    IRQn_TypeDef         IRQn;      /*!< CLIC interrupt line activating the task. */
+    uint8_t              Level;     /*!< CLIC interrupt level of the task (task priority). */
+    TASK_Handler_TypeDef Handler;   /*!< Event handler. */
+    TASK_Event_TypeDef*  Queue;     /*!< Event queue buffer of Size elements. */
+    uint32_t             Size;      /*!< Number of events in the queue buffer, power of 2. */
+    volatile uint32_t    Head;      /*!< Free-running write index. */
+    volatile uint32_t    Tail;      /*!< Free-running read index. */
+    uint32_t             Overflows; /*!< Number of the events rejected because the queue was full. */
+} TASK_TypeDef;
+
+#define IS_TASK_QUEUE_SIZE(SIZE) (((SIZE) != 0) && (((SIZE) & ((SIZE) - 1)) == 0))
+
+/** @} */ /* End of the group MDR32VF0xI_System_TASK_Exported_Types */
+
+/** @addtogroup MDR32VF0xI_System_TASK_Exported_Functions MDR32VF0xI System TASK Exported Functions
+ * @{
+ */
+
+void TASK_Init(void);
+void TASK_Create(TASK_TypeDef* Task, IRQn_TypeDef IRQn, uint8_t Level, TASK_Handler_TypeDef Handler,
+                 TASK_Event_TypeDef* Queue, uint32_t Size);
+
+ErrorStatus TASK_Post(TASK_TypeDef* Task, uint32_t Signal, void* Param);
+
+uint8_t TASK_Lock(uint8_t CeilingLevel);
+void    TASK_Unlock(uint8_t PrevThreshold);
+
+/** @} */ /* End of the group MDR32VF0xI_System_TASK_Exported_Functions */
+
+/** @addtogroup MDR32VF0xI_System_TASK_Exported_IRQ_Handlers MDR32VF0xI System TASK Exported IRQ Handlers
+ * @{
+ */
+
+void TASK_IRQHandler(void);
+
+/** @} */ /* End of the group MDR32VF0xI_System_TASK_Exported_IRQ_Handlers */
+
+#endif /* USE_MDR1206 */
+
+/** @} */ /* End of the group MDR32VF0xI_System_TASK */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_TASK_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_task.h */
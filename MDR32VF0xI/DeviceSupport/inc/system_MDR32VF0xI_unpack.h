@@ -0,0 +1,76 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_unpack.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the functions prototypes for the startup
+ *          section decompression (UNPACK).
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SYSTEM_MDR32VF0xI_UNPACK_H
+#define SYSTEM_MDR32VF0xI_UNPACK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_config.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_UNPACK MDR32VF0xI System UNPACK
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_UNPACK_Exported_Defines MDR32VF0xI System UNPACK Exported Defines
+ * @{
+ */
+
+#define UNPACK_LZ4_FLAG 0x1U /*!< __copy_table load address flag of an LZ4 packed section. */
+
+/** @} */ /* End of the group MDR32VF0xI_System_UNPACK_Exported_Defines */
+
+/** @addtogroup MDR32VF0xI_System_UNPACK_Exported_Functions MDR32VF0xI System UNPACK Exported Functions
+ * @{
+ */
+
+const uint8_t* UNPACK_LZ4(const uint8_t* Src, uint8_t* Dst, const uint8_t* DstEnd);
+
+/** @} */ /* End of the group MDR32VF0xI_System_UNPACK_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_UNPACK */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+#ifdef __cplusplus
+} // extern "C" block end
+#endif
+
+#endif /* SYSTEM_MDR32VF0xI_UNPACK_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_unpack.h */
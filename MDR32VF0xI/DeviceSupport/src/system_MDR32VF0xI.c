@@ -22,6 +22,9 @@
 /* Includes ------------------------------------------------------------------*/
 #include "system_MDR32VF0xI.h"
 #include "system_MDR32VF0xI_it.h"
+#include "system_MDR32VF0xI_clock.h"
+#include "system_MDR32VF0xI_clkcfg.h"
+#include "system_MDR32VF0xI_bootprof.h"
 
 /** @addtogroup DEVICE_SUPPORT Device Support
  * @{
@@ -39,24 +42,44 @@
  * @{
  */
 
+#if (CLKTREE_STATIC == 0)
 /**
  * @brief System clock frequency (core clock) value.
  */
 uint32_t SystemCoreClock = (uint32_t)HSI_FREQUENCY_Hz;
+#endif
+
+/**
+ * @brief HSI frequency value, updated by the HSI calibration (HSICAL).
+ */
+uint32_t SystemHSIClock = (uint32_t)HSI_FREQUENCY_Hz;
 
 /** @} */ /* End of group MDR32VF0xI_System_Exported_Variables */
 
+#if (CLKTREE_STATIC == 1)
+/* Check the static clock tree against the generator frequency and the PLL limits. */
+_Static_assert(CLKTREE_CPU_C1_Hz != 0, "CLKTREE: CPU_C1 frequency is 0.");
+_Static_assert(CLKTREE_CPU_C2_Hz <= CLKCFG_MAX_FREQUENCY_Hz, "CLKTREE: CPU_C2 (PLL output) exceeds CLKCFG_MAX_FREQUENCY_Hz.");
+_Static_assert(CLKTREE_CPU_C2_Hz / CLKTREE_CPU_C1_Hz == ((CLKTREE_PLL_MUL != 0) ? CLKTREE_PLL_MUL : 1), "CLKTREE: CPU_C2 frequency overflow.");
+_Static_assert(CLKTREE_HCLK_Hz != 0, "CLKTREE: HCLK frequency is 0.");
+_Static_assert(CLKTREE_MTIME_Hz != 0, "CLKTREE: MTIME frequency is 0.");
+#endif
+
 /** @defgroup MDR32VF0xI_System_Exported_Functions MDR32VF0xI System Exported Functions
  * @{
  */
 
 /**
  * @brief  Update SystemCoreClock according to clock register values.
+ * @note   The clock calibration (CLOCK_Init) is updated with SystemCoreClock
+ *         if CLOCK_USE_CORE_CLOCK_UPDATE is 1. If CLKTREE_STATIC is 1,
+ *         SystemCoreClock is a constant and only the clock calibration is updated.
  * @param  None.
  * @return None.
  */
-void SystemCoreClockUpdate(void)
+__NO_INSTRUMENT void SystemCoreClockUpdate(void)
 {
+#if (CLKTREE_STATIC == 0)
     uint32_t CPU_C1_Freq = 0, CPU_C2_Freq = 0, CPU_C3_Freq = 0;
     uint32_t PLL_Mult = 0;
     uint32_t Temp1 = 0, Temp2 = 0;
@@ -68,7 +91,7 @@ void SystemCoreClockUpdate(void)
     /* Select CPU_CLK from HSI, CPU_C3, LSE, LSI cases. */
     switch (Temp1 & RST_CLK_CPU_CLOCK_HCLK_SEL_Msk) {
         case RST_CLK_CPU_CLOCK_HCLK_SEL_HSI:
-            SystemCoreClock = HSI_FREQUENCY_Hz;
+            SystemCoreClock = SystemHSIClock;
             break;
 
         case RST_CLK_CPU_CLOCK_HCLK_SEL_LSE:
@@ -83,10 +106,10 @@ void SystemCoreClockUpdate(void)
             /* Determine CPU_C1 frequency. */
             switch (Temp1 & RST_CLK_CPU_CLOCK_CPU_C1_SEL_Msk) {
                 case RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSI:
-                    CPU_C1_Freq = HSI_FREQUENCY_Hz;
+                    CPU_C1_Freq = SystemHSIClock;
                     break;
                 case RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSI_DIV_2:
-                    CPU_C1_Freq = HSI_FREQUENCY_Hz / 2;
+                    CPU_C1_Freq = SystemHSIClock / 2;
                     break;
                 case RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSE:
                     CPU_C1_Freq = HSE_FREQUENCY_Hz;
@@ -122,36 +145,65 @@ void SystemCoreClockUpdate(void)
             SystemCoreClock = CPU_C3_Freq;
             break;
     }
+#endif
+
+#if (CLOCK_USE_CORE_CLOCK_UPDATE == 1)
+    CLOCK_Init();
+#endif
 }
 
 /**
  * @brief  Setup the microcontroller system:
  *          - RST clock configuration to the default reset state;
  *          - SystemCoreClock variable;
- *          - interrupt configuration.
+ *          - interrupt stack (if USE_IT_STACK is 1);
+ *          - interrupt configuration;
+ *          - static clock tree (if CLKTREE_STATIC is 1);
+ *          - boot phase marks (if STARTUP_MEASURE_CYCLES is 1).
  * @note   This function should be used only after reset.
  * @param  None.
  * @return None.
  */
-void SystemInit(void)
+__NO_INSTRUMENT void SystemInit(void)
 {
 #if defined(USE_MDR1206)
     CLIC_InitTypeDef CLIC_InitStruct;
 #endif
+#if (CLKTREE_STATIC == 1)
+    const CLKCFG_Config_TypeDef ClockConfig = CLKTREE_CONFIG_INIT;
+#endif
+
+#if (USE_IT_STACK == 1)
+    IT_InitStack();
+#endif
 
 #if defined(USE_MDR32F02)
-    PLIC_SetTrapVector(PLIC_PRIVILEGE_IRQ_MODE_M, Trap_IRQHandler);
+    PLIC_SetTrapVector(PLIC_PRIVILEGE_IRQ_MODE_M, IT_TRAP_VECTOR);
     IT_GlobalEnableIRQ();
 #elif defined(USE_MDR1206)
     CLIC_StructInit(&CLIC_InitStruct);
     CLIC_Init(&CLIC_InitStruct);
 
-    CLIC_SetTrapVector(CLIC_PRIVILEGE_MODE_IRQ_M, Trap_IRQHandler);
+    CLIC_SetTrapVector(CLIC_PRIVILEGE_MODE_IRQ_M, IT_TRAP_VECTOR);
     CLIC_SetVectorTable(CLIC_PRIVILEGE_MODE_IRQ_M, InterruptVectorTable);
     IT_GlobalEnableIRQ(IT_PRIVILEGE_MODE_IRQ_M);
 #endif
+#if (STARTUP_MEASURE_CYCLES == 1)
+    BOOTPROF_Mark(BOOTPROF_ID_SYSTEM_IT);
+#endif
+
+#if (CLKTREE_STATIC == 1)
+#if !defined(USE_MDR32F02_REV_1X)
+    MDR_RST_CLK->DIV_SYS_TIM = CLKTREE_DIV_SYS_TIM;
+#endif
+    /* SystemCoreClock is a constant, so the clock tree can not fall back to HSI. */
+    while (CLKCFG_Apply(&ClockConfig) == ERROR) { }
+#endif
 
     SystemCoreClockUpdate();
+#if (STARTUP_MEASURE_CYCLES == 1)
+    BOOTPROF_Mark(BOOTPROF_ID_SYSTEM_CLOCK);
+#endif
 }
 
 /** @} */ /* End of group MDR32VF0xI_System_Exported_Functions */
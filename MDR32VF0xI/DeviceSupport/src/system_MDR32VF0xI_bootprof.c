@@ -0,0 +1,160 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_bootprof.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the boot phase profiler (BOOTPROF)
+ *          firmware functions.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_bootprof.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_BOOTPROF MDR32VF0xI System BOOTPROF
+ * @{
+ */
+
+#if (STARTUP_MEASURE_CYCLES == 1)
+
+/** @addtogroup MDR32VF0xI_System_BOOTPROF_Exported_Variables MDR32VF0xI System BOOTPROF Exported Variables
+ * @{
+ */
+
+/**
+ * @brief BOOTPROF record of the current boot.
+ */
+__NOINIT BOOTPROF_Record_TypeDef BOOTPROF_Record;
+
+/**
+ * @brief BOOTPROF record of the previous boot.
+ */
+__NOINIT BOOTPROF_Record_TypeDef BOOTPROF_PrevRecord;
+
+/** @} */ /* End of the group MDR32VF0xI_System_BOOTPROF_Exported_Variables */
+
+/** @defgroup MDR32VF0xI_System_BOOTPROF_Private_Functions MDR32VF0xI System BOOTPROF Private Functions
+ * @{
+ */
+
+/**
+ * @brief  Add a mark to the current record.
+ * @note   The phases up to BOOTPROF_ID_SYSTEM_CLOCK run from the reset clock (HSI),
+ *         SystemCoreClock is not valid before SystemInit if CLKTREE_STATIC is 1.
+ * @param  Id: Mark identifier, BOOTPROF_ID_*.
+ * @param  Cycles: MCYCLE at the mark.
+ * @return None.
+ */
+__STATIC_INLINE void BOOTPROF_AddMark(uint32_t Id, uint32_t Cycles)
+{
+    BOOTPROF_Mark_TypeDef* Mark;
+
+    if (BOOTPROF_Record.Count >= BOOTPROF_NUM_MARKS) {
+        return;
+    }
+
+    Mark              = &BOOTPROF_Record.Mark[BOOTPROF_Record.Count];
+    Mark->Cycles      = Cycles;
+    Mark->ClockFreq   = (Id < BOOTPROF_ID_SYSTEM_CLOCK) ? SystemHSIClock : SystemCoreClock;
+    Mark->Id          = (uint8_t)Id;
+    Mark->Reserved[0] = 0;
+    Mark->Reserved[1] = 0;
+    Mark->Reserved[2] = 0;
+    BOOTPROF_Record.Count++;
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_BOOTPROF_Private_Functions */
+
+/** @addtogroup MDR32VF0xI_System_BOOTPROF_Exported_Functions MDR32VF0xI System BOOTPROF Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Start the record of the current boot, called by the startup file
+ *         after the section copy and zeroing.
+ * @note   A valid record left by the previous boot is moved to BOOTPROF_PrevRecord,
+ *         so the boot interrupted by a warm reset can be read after it.
+ * @param  StartCycles: MCYCLE at the _start entry.
+ * @param  CopyCycles: MCYCLE after the section copy.
+ * @param  ZeroCycles: MCYCLE after the section zeroing.
+ * @param  DMAWaitCycles: MCYCLE after the DMA section copy wait.
+ * @return None.
+ */
+__NO_INSTRUMENT void BOOTPROF_Start(uint32_t StartCycles, uint32_t CopyCycles, uint32_t ZeroCycles, uint32_t DMAWaitCycles)
+{
+    uint32_t BootCount = 1;
+
+    if ((BOOTPROF_Record.Magic == BOOTPROF_MAGIC) &&
+        (BOOTPROF_Record.Version == BOOTPROF_VERSION) &&
+        (BOOTPROF_Record.NumMarks == BOOTPROF_NUM_MARKS) &&
+        (BOOTPROF_Record.Count <= BOOTPROF_NUM_MARKS)) {
+        BOOTPROF_PrevRecord = BOOTPROF_Record;
+        BootCount           = BOOTPROF_Record.BootCount + 1;
+    } else {
+        BOOTPROF_PrevRecord.Magic = 0;
+    }
+
+    BOOTPROF_Record.Magic     = 0;
+    BOOTPROF_Record.Version   = BOOTPROF_VERSION;
+    BOOTPROF_Record.NumMarks  = BOOTPROF_NUM_MARKS;
+    BOOTPROF_Record.Count     = 0;
+    BOOTPROF_Record.BootCount = BootCount;
+
+    BOOTPROF_AddMark(BOOTPROF_ID_START, StartCycles);
+    BOOTPROF_AddMark(BOOTPROF_ID_COPY, CopyCycles);
+    BOOTPROF_AddMark(BOOTPROF_ID_ZERO, ZeroCycles);
+#if (STARTUP_USE_DMA == 1)
+    BOOTPROF_AddMark(BOOTPROF_ID_DMA_WAIT, DMAWaitCycles);
+#else
+    (void)DMAWaitCycles;
+#endif
+    __COMPILER_BARRIER();
+    BOOTPROF_Record.Magic = BOOTPROF_MAGIC;
+}
+
+/**
+ * @brief  Record the end of a boot phase.
+ * @note   Called by the startup file and SystemInit, the application marks its
+ *         own initialization steps with BOOTPROF_ID_USER + N. The marks after
+ *         BOOTPROF_NUM_MARKS are dropped.
+ * @param  Id: Mark identifier, BOOTPROF_ID_*.
+ * @return None.
+ */
+__NO_INSTRUMENT void BOOTPROF_Mark(uint32_t Id)
+{
+    BOOTPROF_AddMark(Id, (uint32_t)csr_read(CSR_MCYCLE));
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_BOOTPROF_Exported_Functions */
+
+#endif /* STARTUP_MEASURE_CYCLES == 1 */
+
+/** @} */ /* End of the group MDR32VF0xI_System_BOOTPROF */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_bootprof.c */
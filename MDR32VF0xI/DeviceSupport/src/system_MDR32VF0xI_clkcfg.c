@@ -0,0 +1,280 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_clkcfg.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the clock configuration solver (CLKCFG) firmware functions.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_clkcfg.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_CLKCFG MDR32VF0xI System CLKCFG
+ * @{
+ */
+
+/** @defgroup MDR32VF0xI_System_CLKCFG_Private_Defines MDR32VF0xI System CLKCFG Private Defines
+ * @{
+ */
+
+/**
+ * @brief Number of the polling iterations to wait for HSE_RDY or PLL_CPU_RDY.
+ */
+#define CLKCFG_READY_TIMEOUT ((uint32_t)0x00100000)
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLKCFG_Private_Defines */
+
+/** @defgroup MDR32VF0xI_System_CLKCFG_Private_Functions_Declarations MDR32VF0xI System CLKCFG Private Functions Declarations
+ * @{
+ */
+
+static ErrorStatus CLKCFG_WaitReady(uint32_t Flag);
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLKCFG_Private_Functions_Declarations */
+
+/** @addtogroup MDR32VF0xI_System_CLKCFG_Exported_Functions MDR32VF0xI System CLKCFG Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Find the clock configuration with the highest HCLK frequency
+ *         not exceeding the target frequency and CLKCFG_MAX_FREQUENCY_Hz.
+ * @note   Pure function, does not access the hardware. All the CPU_C1 sources
+ *         of the generator (undivided and divided by 2), the PLL multipliers
+ *         and the CPU_C3 dividers are searched. Between the configurations with
+ *         the same HCLK frequency, the one with the lowest CPU_C2 frequency
+ *         (the lowest PLL power) is selected.
+ * @param  Config: Pointer to the configuration to fill.
+ * @param  Source: @ref CLKCFG_Source_TypeDef - clock generator.
+ * @param  SourceFreq: Generator frequency [Hz], for example, HSE_FREQUENCY_Hz.
+ * @param  TargetFreq: Requested HCLK frequency [Hz].
+ * @return @ref ErrorStatus - SUCCESS if a configuration is found, ERROR if
+ *         the target is below the lowest reachable frequency.
+ */
+ErrorStatus CLKCFG_Solve(CLKCFG_Config_TypeDef* Config, CLKCFG_Source_TypeDef Source,
+                         uint32_t SourceFreq, uint32_t TargetFreq)
+{
+    uint32_t    Limit, C1Freq, C2Freq, Freq, BestC2Freq = 0;
+    uint32_t    C1Div, Mul, Shift;
+    ErrorStatus Status = ERROR;
+
+    /* Check the parameters. */
+    assert_param(Config != NULL);
+    assert_param(IS_CLKCFG_SOURCE(Source));
+
+    Limit = (TargetFreq < CLKCFG_MAX_FREQUENCY_Hz) ? TargetFreq : CLKCFG_MAX_FREQUENCY_Hz;
+
+    Config->Frequency = 0;
+
+    for (C1Div = 0; C1Div <= 1; C1Div++) {
+        C1Freq = SourceFreq >> C1Div;
+
+        /* Mul 1 stands for the PLL bypass (CPU_C2 = CPU_C1). */
+        for (Mul = 1; Mul <= CLKCFG_PLL_MUL_MAX; Mul++) {
+            C2Freq = C1Freq * Mul;
+            if (C2Freq > CLKCFG_MAX_FREQUENCY_Hz) {
+                break;
+            }
+
+            /* The smallest divider keeping HCLK within the limit. */
+            for (Shift = 0; Shift <= CLKCFG_C3_DIV_SHIFT_MAX; Shift++) {
+                Freq = C2Freq >> Shift;
+                if (Freq <= Limit) {
+                    break;
+                }
+            }
+            if ((Shift > CLKCFG_C3_DIV_SHIFT_MAX) || (Freq == 0)) {
+                continue;
+            }
+
+            if ((Status == ERROR) || (Freq > Config->Frequency) ||
+                ((Freq == Config->Frequency) && (C2Freq < BestC2Freq))) {
+                if (Source == CLKCFG_SOURCE_HSI) {
+                    Config->CPU_C1Sel = (C1Div == 0) ? RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSI : RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSI_DIV_2;
+                } else {
+                    Config->CPU_C1Sel = (C1Div == 0) ? RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSE : RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSE_DIV_2;
+                }
+                Config->PLLMul    = (Mul == 1) ? 0 : Mul;
+                Config->CPU_C3Div = 1UL << Shift;
+                Config->Frequency = Freq;
+                BestC2Freq        = C2Freq;
+                Status            = SUCCESS;
+            }
+        }
+    }
+
+    if (Status == SUCCESS) {
+        Config->FlashDelay = CLKCFG_GetFlashDelay(Config->Frequency);
+    }
+
+    return Status;
+}
+
+/**
+ * @brief  Get the FLASH wait states required for an HCLK frequency.
+ * @note   Pure function, does not access the hardware.
+ * @param  Frequency: HCLK frequency [Hz].
+ * @return FLASH_CMD_DELAY_CYCLE_0 or FLASH_CMD_DELAY_CYCLE_1.
+ */
+uint32_t CLKCFG_GetFlashDelay(uint32_t Frequency)
+{
+    return (Frequency <= CLKCFG_FLASH_DELAY_0_MAX_Hz) ? FLASH_CMD_DELAY_CYCLE_0 : FLASH_CMD_DELAY_CYCLE_1;
+}
+
+/**
+ * @brief  Program the clock configuration found by CLKCFG_Solve.
+ * @note   The switch is glitch-free: HCLK is moved to HSI first, then
+ *         the FLASH wait states, the generator, CPU_C1, the PLL and CPU_C3 are
+ *         programmed while they do not clock the core, and HCLK is moved to
+ *         CPU_C3 after HSE_RDY and PLL_CPU_RDY are set. The FLASH wait states
+ *         are valid for HSI during the switch, so no intermediate setting is needed.
+ *         HSE is not disabled if the configuration does not use it.
+ *         SystemCoreClockUpdate should be called after the function.
+ * @param  Config: Pointer to the configuration.
+ * @return @ref ErrorStatus - SUCCESS if the configuration is applied, ERROR if
+ *         HSE or the PLL is not ready in time, HCLK is left on HSI then.
+ */
+ErrorStatus CLKCFG_Apply(const CLKCFG_Config_TypeDef* Config)
+{
+    uint32_t CPUClock, PLLControl, C3Sel = 0, Div;
+
+    /* Check the parameters. */
+    assert_param(Config != NULL);
+    assert_param((Config->PLLMul == 0) ||
+                 ((Config->PLLMul >= CLKCFG_PLL_MUL_MIN) && (Config->PLLMul <= CLKCFG_PLL_MUL_MAX)));
+
+    /* Move HCLK to HSI, CPU_C1, CPU_C2 and CPU_C3 are free to change. */
+    CPUClock = MDR_RST_CLK->CPU_CLOCK & ~RST_CLK_CPU_CLOCK_HCLK_SEL_Msk;
+    MDR_RST_CLK->CPU_CLOCK = CPUClock | RST_CLK_CPU_CLOCK_HCLK_SEL_HSI;
+
+    MDR_FLASH->CMD = (MDR_FLASH->CMD & ~FLASH_CMD_DELAY_Msk) | Config->FlashDelay;
+
+    if ((Config->CPU_C1Sel == RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSE) ||
+        (Config->CPU_C1Sel == RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSE_DIV_2)) {
+#if (HSE_EXT_GEN_MODE == 1)
+        MDR_RST_CLK->HS_CONTROL = RST_CLK_HS_CONTROL_HSE_ON | RST_CLK_HS_CONTROL_HSE_BYP;
+#else
+        MDR_RST_CLK->HS_CONTROL = RST_CLK_HS_CONTROL_HSE_ON;
+#endif
+        if (CLKCFG_WaitReady(RST_CLK_CLOCK_STATUS_HSE_RDY) == ERROR) {
+            return ERROR;
+        }
+    }
+
+    CPUClock = (CPUClock & ~(RST_CLK_CPU_CLOCK_CPU_C1_SEL_Msk | RST_CLK_CPU_CLOCK_CPU_C2_SEL)) | Config->CPU_C1Sel;
+    MDR_RST_CLK->CPU_CLOCK = CPUClock | RST_CLK_CPU_CLOCK_HCLK_SEL_HSI;
+
+    /* The PLL is stopped to change the multiplier, its source is CPU_C1. */
+    PLLControl = MDR_RST_CLK->PLL_CONTROL & ~(RST_CLK_PLL_CONTROL_PLL_CPU_ON | RST_CLK_PLL_CONTROL_PLL_CPU_MUL_Msk);
+    MDR_RST_CLK->PLL_CONTROL = PLLControl;
+
+    if (Config->PLLMul != 0) {
+        PLLControl |= RST_CLK_PLL_CONTROL_PLL_CPU_SEL | ((Config->PLLMul - 1) << RST_CLK_PLL_CONTROL_PLL_CPU_MUL_Pos);
+        MDR_RST_CLK->PLL_CONTROL = PLLControl;
+        MDR_RST_CLK->PLL_CONTROL = PLLControl | RST_CLK_PLL_CONTROL_PLL_CPU_ON;
+        if (CLKCFG_WaitReady(RST_CLK_CLOCK_STATUS_PLL_CPU_RDY) == ERROR) {
+            return ERROR;
+        }
+        CPUClock |= RST_CLK_CPU_CLOCK_CPU_C2_SEL;
+    }
+
+    /* CPU_C3_SEL: 0xxx - no division, 1xxx - division by 2^(xxx + 1). */
+    for (Div = Config->CPU_C3Div; Div > 1; Div >>= 1) {
+        C3Sel = (C3Sel == 0) ? 0x8U : (C3Sel + 1);
+    }
+    CPUClock = (CPUClock & ~RST_CLK_CPU_CLOCK_CPU_C3_SEL_Msk) | (C3Sel << RST_CLK_CPU_CLOCK_CPU_C3_SEL_Pos);
+
+    MDR_RST_CLK->CPU_CLOCK = CPUClock | RST_CLK_CPU_CLOCK_HCLK_SEL_HSI;
+    MDR_RST_CLK->CPU_CLOCK = CPUClock | RST_CLK_CPU_CLOCK_HCLK_SEL_CPU_C3;
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Configure the core clock (HCLK) to the highest frequency not exceeding
+ *         the target frequency: select CPU_C1, the CPU PLL multiplier, the CPU_C3
+ *         divider and the FLASH wait states, switch to them and update SystemCoreClock.
+ * @note   The generator is HSE if CLKCFG_USE_HSE is 1, HSI is used if HSE is
+ *         not ready in time. The frequency is limited by CLKCFG_MAX_FREQUENCY_Hz.
+ *         Declared in system_MDR32VF0xI.h, defined here so that the system
+ *         file links without the solver.
+ * @param  TargetFreq: Requested core clock frequency [Hz].
+ * @return Achieved core clock frequency [Hz], 0 if the clock is not changed.
+ */
+#if (CLKTREE_STATIC == 0)
+uint32_t SystemClockConfig(uint32_t TargetFreq)
+{
+    CLKCFG_Config_TypeDef Config;
+    ErrorStatus           Status = ERROR;
+
+#if (CLKCFG_USE_HSE == 1)
+    if (CLKCFG_Solve(&Config, CLKCFG_SOURCE_HSE, HSE_FREQUENCY_Hz, TargetFreq) == SUCCESS) {
+        Status = CLKCFG_Apply(&Config);
+    }
+#endif
+    if ((Status == ERROR) && (CLKCFG_Solve(&Config, CLKCFG_SOURCE_HSI, SystemHSIClock, TargetFreq) == SUCCESS)) {
+        Status = CLKCFG_Apply(&Config);
+    }
+
+    SystemCoreClockUpdate();
+
+    return (Status == SUCCESS) ? SystemCoreClock : 0;
+}
+#endif
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLKCFG_Exported_Functions */
+
+/** @defgroup MDR32VF0xI_System_CLKCFG_Private_Functions MDR32VF0xI System CLKCFG Private Functions
+ * @{
+ */
+
+/**
+ * @brief  Wait for a ready flag of the CLOCK_STATUS register.
+ * @param  Flag: RST_CLK_CLOCK_STATUS_HSE_RDY or RST_CLK_CLOCK_STATUS_PLL_CPU_RDY.
+ * @return @ref ErrorStatus - SUCCESS if the flag is set, ERROR on timeout.
+ */
+static ErrorStatus CLKCFG_WaitReady(uint32_t Flag)
+{
+    uint32_t Count = CLKCFG_READY_TIMEOUT;
+
+    while ((MDR_RST_CLK->CLOCK_STATUS & Flag) == 0) {
+        if (Count-- == 0) {
+            return ERROR;
+        }
+    }
+
+    return SUCCESS;
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLKCFG_Private_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLKCFG */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_clkcfg.c */
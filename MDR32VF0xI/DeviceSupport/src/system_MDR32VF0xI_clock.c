@@ -0,0 +1,152 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_clock.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the monotonic clock (CLOCK) firmware functions.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_clock.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_CLOCK MDR32VF0xI System CLOCK
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_CLOCK_Exported_Variables MDR32VF0xI System CLOCK Exported Variables
+ * @{
+ */
+
+/**
+ * @brief CLOCK calibration.
+ */
+CLOCK_Calib_TypeDef CLOCK_Calib;
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLOCK_Exported_Variables */
+
+/** @addtogroup MDR32VF0xI_System_CLOCK_Exported_Functions MDR32VF0xI System CLOCK Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Compute the clock calibration from SystemCoreClock and
+ *         the machine timer prescaler, the first call enables the MCYCLE counter.
+ * @note   Called by SystemCoreClockUpdate if CLOCK_USE_CORE_CLOCK_UPDATE is 1,
+ *         by the application after SystemInit otherwise. Should be called after
+ *         a core clock change not made by FREQ and after a change
+ *         of the machine timer prescaler, with the interrupts disabled if
+ *         CLOCK_GetNs is used by the interrupt handlers. The time to the call
+ *         is added to the monotonic time base with the previous calibration,
+ *         the ticks counted between the clock switch and the call are
+ *         converted with it too.
+ * @param  None.
+ * @return None.
+ */
+void CLOCK_Init(void)
+{
+    uint64_t Ticks = CLOCK_GetTicks();
+
+    if (CLOCK_Calib.TickFreq != 0) {
+        CLOCK_Calib.BaseNs   += CLOCK_TicksToNs(Ticks - CLOCK_Calib.BaseTicks);
+        CLOCK_Calib.BaseTicks = Ticks;
+    } else {
+        /* Clear MCOUNTINHIBIT.CY so that MCYCLE counts. */
+        csr_clear_bits(CSR_MCOUNTINHIBIT, 0x1);
+    }
+
+    CLOCK_Calib.TickFreq  = CLOCK_GetTickFreq();
+    CLOCK_Calib.CycleFreq = SystemCoreClock;
+
+    CLOCK_InitConv(&CLOCK_Calib.TicksToNs, CLOCK_Calib.TickFreq, CLOCK_NS_PER_SECOND);
+    CLOCK_InitConv(&CLOCK_Calib.NsToTicks, CLOCK_NS_PER_SECOND, CLOCK_Calib.TickFreq);
+    CLOCK_InitConv(&CLOCK_Calib.CyclesToNs, CLOCK_Calib.CycleFreq, CLOCK_NS_PER_SECOND);
+    CLOCK_InitConv(&CLOCK_Calib.NsToCycles, CLOCK_NS_PER_SECOND, CLOCK_Calib.CycleFreq);
+    CLOCK_InitConv(&CLOCK_Calib.UsToCycles, CLOCK_US_PER_SECOND, CLOCK_Calib.CycleFreq);
+}
+
+/**
+ * @brief  Get the machine timer frequency.
+ * @note   MTIME is clocked by HCLK divided by (DIV_SYS_TIM + 1),
+ *         MDR32F02 rev. 1.x has no prescaler. The value is a constant
+ *         if CLKTREE_STATIC is 1.
+ * @param  None.
+ * @return Machine timer frequency [Hz].
+ */
+uint32_t CLOCK_GetTickFreq(void)
+{
+#if (CLKTREE_STATIC == 1)
+    return CLKTREE_MTIME_Hz;
+#elif defined(USE_MDR32F02_REV_1X)
+    return SystemCoreClock;
+#else
+    return SystemCoreClock /
+           (((MDR_RST_CLK->DIV_SYS_TIM & RST_CLK_DIV_SYS_TIM_DIV_SYS_TIM_Msk) >> RST_CLK_DIV_SYS_TIM_DIV_SYS_TIM_Pos) + 1);
+#endif
+}
+
+/**
+ * @brief  Compute a fixed-point conversion factor from InFreq units to
+ *         OutFreq units with the largest shift keeping Mult in 32 bits.
+ * @note   Pure function, does not access the hardware. Mult is rounded down,
+ *         so the converted values are rounded down with the relative error
+ *         less than 2^-31. Uses a 64-bit division, not intended for the hot paths.
+ * @param  Conv: Pointer to the conversion factor to fill.
+ * @param  InFreq: Input unit frequency [Hz], not 0.
+ * @param  OutFreq: Output unit frequency [Hz].
+ * @return None.
+ */
+void CLOCK_InitConv(CLOCK_Conv_TypeDef* Conv, uint32_t InFreq, uint32_t OutFreq)
+{
+    uint32_t Shift = 0;
+
+    /* Check the parameters. */
+    assert_param(Conv != NULL);
+    assert_param(InFreq != 0);
+
+    while (Shift < 63) {
+        /* Stop if OutFreq << (Shift + 1) overflows 64 bits or Mult overflows 32 bits. */
+        if ((Shift >= 32) && ((OutFreq >> (63 - Shift)) != 0)) {
+            break;
+        }
+        if ((((uint64_t)OutFreq << (Shift + 1)) / InFreq) > 0xFFFFFFFFUL) {
+            break;
+        }
+        Shift++;
+    }
+
+    Conv->Mult  = (uint32_t)(((uint64_t)OutFreq << Shift) / InFreq);
+    Conv->Shift = Shift;
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLOCK_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_CLOCK */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_clock.c */
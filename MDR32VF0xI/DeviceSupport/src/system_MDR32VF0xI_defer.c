@@ -0,0 +1,351 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_defer.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the deferred work (DEFER) firmware functions.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_defer.h"
+#include "system_MDR32VF0xI_it.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_DEFER MDR32VF0xI System DEFER
+ * @{
+ */
+
+/** @defgroup MDR32VF0xI_System_DEFER_Private_Variables MDR32VF0xI System DEFER Private Variables
+ * @{
+ */
+
+/**
+ * @brief Registered queues sorted by priority (the highest first).
+ */
+static DEFER_Queue_TypeDef* DEFER_QueueList = NULL;
+
+/** @} */ /* End of the group MDR32VF0xI_System_DEFER_Private_Variables */
+
+/** @defgroup MDR32VF0xI_System_DEFER_Private_Functions MDR32VF0xI System DEFER Private Functions
+ * @{
+ */
+
+/**
+ * @brief  Get the timestamp for the latency statistics.
+ * @param  None.
+ * @return Lower 32 bits of MCYCLE.
+ */
+__STATIC_INLINE uint32_t DEFER_GetTimestamp(void)
+{
+    return (uint32_t)csr_read(CSR_MCYCLE);
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_DEFER_Private_Functions */
+
+/** @addtogroup MDR32VF0xI_System_DEFER_Exported_Functions MDR32VF0xI System DEFER Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the deferred work: clear the queue list and,
+ *         if DEFER_USE_SWI is 1, configure and enable the software interrupt
+ *         (CSIP at DEFER_SWI_LEVEL for MDR1206, MSIP for MDR32F02).
+ * @note   Should be called before the interrupts posting the work are enabled.
+ * @param  None.
+ * @return None.
+ */
+void DEFER_Init(void)
+{
+#if (DEFER_USE_SWI == 1) && defined(USE_MDR1206)
+    CLIC_IRQ_InitTypeDef CLIC_IRQ_InitStruct;
+#endif
+
+    DEFER_QueueList = NULL;
+
+#if (DEFER_USE_SWI == 1)
+#if defined(USE_MDR1206)
+    CLIC_StructInitIRQ(&CLIC_IRQ_InitStruct);
+    CLIC_IRQ_InitStruct.CLIC_EnableIRQ    = ENABLE;
+    CLIC_IRQ_InitStruct.CLIC_VectoringIRQ = DISABLE;
+    CLIC_IRQ_InitStruct.CLIC_LevelIRQ     = DEFER_SWI_LEVEL;
+    CLIC_ClearPendingIRQ(CSIP_IRQn);
+    CLIC_InitIRQ(CSIP_IRQn, &CLIC_IRQ_InitStruct);
+#elif defined(USE_MDR32F02)
+    CLINT_SetSoftwareMachineIRQ(RESET);
+    PLIC_EnableSoftwareIRQ(PLIC_PRIVILEGE_IRQ_MODE_M);
+#endif
+#endif
+}
+
+/**
+ * @brief  Initialize a queue and register it for DEFER_Process.
+ * @note   Should be called before the queue is used by the producer and the consumer.
+ * @param  Queue: Pointer to the queue.
+ * @param  Buffer: Pointer to the item buffer of Size elements.
+ * @param  Size: Number of items in the buffer, should be a power of 2.
+ * @param  Priority: Queue priority, 0 is the highest. Queues of equal priority
+ *         are drained in registration order.
+ * @return None.
+ */
+void DEFER_InitQueue(DEFER_Queue_TypeDef* Queue, DEFER_Item_TypeDef* Buffer, uint32_t Size, uint32_t Priority)
+{
+    DEFER_Queue_TypeDef** Link = &DEFER_QueueList;
+
+    /* Check the parameters. */
+    assert_param(Queue != NULL);
+    assert_param(Buffer != NULL);
+    assert_param(IS_DEFER_QUEUE_SIZE(Size));
+
+    Queue->Buffer   = Buffer;
+    Queue->Size     = Size;
+    Queue->Head     = 0;
+    Queue->Tail     = 0;
+    Queue->Priority = Priority;
+    DEFER_ResetStats(Queue);
+
+    while ((*Link != NULL) && ((*Link)->Priority <= Priority)) {
+        Link = &(*Link)->Next;
+    }
+    Queue->Next = *Link;
+    __COMPILER_BARRIER();
+    *Link = Queue;
+}
+
+/**
+ * @brief  Post a work item to a queue.
+ * @note   Wait-free, intended to be called from the only producer
+ *         of the queue (usually an interrupt handler).
+ * @param  Queue: Pointer to the queue.
+ * @param  Func: Work function.
+ * @param  Arg: Work function argument.
+ * @return @ref ErrorStatus - SUCCESS if the item is posted, ERROR if the queue is full.
+ */
+ErrorStatus DEFER_Post(DEFER_Queue_TypeDef* Queue, DEFER_WorkFunc_TypeDef Func, void* Arg)
+{
+    DEFER_Item_TypeDef* Item;
+    uint32_t            Head  = Queue->Head;
+    uint32_t            Depth = Head - Queue->Tail;
+    ErrorStatus         Status;
+
+    /* Check the parameters. */
+    assert_param(Func != NULL);
+
+    if (Depth >= Queue->Size) {
+        Queue->Stats.Overflows++;
+        Status = ERROR;
+    } else {
+        Item            = &Queue->Buffer[Head & (Queue->Size - 1)];
+        Item->Func      = Func;
+        Item->Arg       = Arg;
+        Item->Timestamp = DEFER_GetTimestamp();
+        /* Publish the item only after it is completely written. */
+        __COMPILER_BARRIER();
+        Queue->Head = Head + 1;
+
+        Queue->Stats.Posted++;
+        if (Depth + 1 > Queue->Stats.MaxDepth) {
+            Queue->Stats.MaxDepth = Depth + 1;
+        }
+#if (DEFER_USE_SWI == 1)
+#if defined(USE_MDR1206)
+        CLIC_SetPendingIRQ(CSIP_IRQn);
+#elif defined(USE_MDR32F02)
+        CLINT_SetSoftwareMachineIRQ(SET);
+#endif
+#endif
+        Status = SUCCESS;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief  Execute the pending work items of all registered queues.
+ * @note   Items are executed one at a time, always from the highest priority
+ *         non-empty queue. Only one context (the main loop or the software
+ *         interrupt handler) may call this function.
+ * @param  None.
+ * @return Number of the executed items.
+ */
+uint32_t DEFER_Process(void)
+{
+    DEFER_Queue_TypeDef*   Queue = DEFER_QueueList;
+    DEFER_WorkFunc_TypeDef Func;
+    void*                  Arg;
+    uint32_t               Tail, Start, Latency, RunTime;
+    uint32_t               Executed = 0;
+
+    while (Queue != NULL) {
+        Tail = Queue->Tail;
+        if (Tail == Queue->Head) {
+            Queue = Queue->Next;
+            continue;
+        }
+
+        __COMPILER_BARRIER();
+        Func    = Queue->Buffer[Tail & (Queue->Size - 1)].Func;
+        Arg     = Queue->Buffer[Tail & (Queue->Size - 1)].Arg;
+        Start   = DEFER_GetTimestamp();
+        Latency = Start - Queue->Buffer[Tail & (Queue->Size - 1)].Timestamp;
+        /* Release the slot only after it is completely read. */
+        __COMPILER_BARRIER();
+        Queue->Tail = Tail + 1;
+
+        Func(Arg);
+
+        RunTime = DEFER_GetTimestamp() - Start;
+        Queue->Stats.Executed++;
+        Queue->Stats.TotalLatency += Latency;
+        if (Latency > Queue->Stats.MaxLatency) {
+            Queue->Stats.MaxLatency = Latency;
+        }
+        Queue->Stats.TotalRunTime += RunTime;
+        if (RunTime > Queue->Stats.MaxRunTime) {
+            Queue->Stats.MaxRunTime = RunTime;
+        }
+        Executed++;
+
+        /* Restart from the highest priority queue. */
+        Queue = DEFER_QueueList;
+    }
+
+    return Executed;
+}
+
+/**
+ * @brief  Get the number of the pending items of a queue.
+ * @param  Queue: Pointer to the queue.
+ * @return Number of the pending items.
+ */
+uint32_t DEFER_GetPending(const DEFER_Queue_TypeDef* Queue)
+{
+    return Queue->Head - Queue->Tail;
+}
+
+/**
+ * @brief  Get the statistics of a queue.
+ * @note   Throughput is the difference of the Executed counters of two
+ *         snapshots divided by the time between them.
+ * @param  Queue: Pointer to the queue.
+ * @param  Stats: Pointer to the @ref DEFER_Stats_TypeDef structure to fill.
+ * @return None.
+ */
+void DEFER_GetStats(const DEFER_Queue_TypeDef* Queue, DEFER_Stats_TypeDef* Stats)
+{
+    *Stats = Queue->Stats;
+}
+
+/**
+ * @brief  Reset the statistics of a queue.
+ * @note   The producer and the consumer of the queue should not run during the reset.
+ * @param  Queue: Pointer to the queue.
+ * @return None.
+ */
+void DEFER_ResetStats(DEFER_Queue_TypeDef* Queue)
+{
+    Queue->Stats.Posted       = 0;
+    Queue->Stats.Overflows    = 0;
+    Queue->Stats.MaxDepth     = 0;
+    Queue->Stats.Executed     = 0;
+    Queue->Stats.MaxLatency   = 0;
+    Queue->Stats.TotalLatency = 0;
+    Queue->Stats.MaxRunTime   = 0;
+    Queue->Stats.TotalRunTime = 0;
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_DEFER_Exported_Functions */
+
+#if (DEFER_USE_SWI == 1)
+/** @addtogroup MDR32VF0xI_System_DEFER_Exported_IRQ_Handlers MDR32VF0xI System DEFER Exported IRQ Handlers
+ * @{
+ */
+
+#if defined(USE_MDR1206)
+/**
+ * @brief  CLIC software interrupt handler: drains the deferred work queues.
+ * @note   Saves MEPC and MCAUSE (with MPIL and MPIE) and re-enables the interrupts
+ *         during the drain, so that the levels above DEFER_SWI_LEVEL preempt the work.
+ *         CSIP requested during the drain does not preempt it (the same level).
+ * @param  None.
+ * @return None.
+ */
+void CSIP_IRQHandler(void)
+{
+    uint_xlen_t MCause, MEpc;
+
+    MCause = csr_read(CSR_MCAUSE);
+    MEpc   = csr_read(CSR_MEPC);
+
+    CLIC_ClearPendingIRQ(CSIP_IRQn);
+    csr_set_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    DEFER_Process();
+
+    csr_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+    csr_write(CSR_MCAUSE, MCause);
+    csr_write(CSR_MEPC, MEpc);
+}
+#elif defined(USE_MDR32F02)
+/**
+ * @brief  Machine software interrupt handler: drains the deferred work queues.
+ * @note   Saves MEPC, MCAUSE and MSTATUS (MPIE and MPP) and re-enables the interrupts
+ *         during the drain, so that the other interrupts preempt the work.
+ *         MSIP is masked during the drain not to re-enter DEFER_Process,
+ *         MSIP requested during the drain is taken after the return.
+ * @param  None.
+ * @return None.
+ */
+void MSIP_IRQHandler(void)
+{
+    uint_xlen_t MStatus, MCause, MEpc;
+
+    MStatus = csr_read(CSR_MSTATUS);
+    MCause  = csr_read(CSR_MCAUSE);
+    MEpc    = csr_read(CSR_MEPC);
+
+    CLINT_SetSoftwareMachineIRQ(RESET);
+    PLIC_DisableSoftwareIRQ(PLIC_PRIVILEGE_IRQ_MODE_M);
+    csr_set_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    DEFER_Process();
+
+    /* MSTATUS at the entry has MIE cleared. */
+    csr_write(CSR_MSTATUS, MStatus);
+    PLIC_EnableSoftwareIRQ(PLIC_PRIVILEGE_IRQ_MODE_M);
+    csr_write(CSR_MCAUSE, MCause);
+    csr_write(CSR_MEPC, MEpc);
+}
+#endif
+
+/** @} */ /* End of the group MDR32VF0xI_System_DEFER_Exported_IRQ_Handlers */
+#endif
+
+/** @} */ /* End of the group MDR32VF0xI_System_DEFER */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_defer.c */
@@ -0,0 +1,120 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_delay.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the busy-wait delays (DELAY) firmware functions.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_delay.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_DELAY MDR32VF0xI System DELAY
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_DELAY_Exported_Functions MDR32VF0xI System DELAY Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Busy-wait a number of the core cycles.
+ * @note   Placed in .ramfunc, so the polling loop does not depend on the FLASH
+ *         wait states. The call and return add a few cycles to the wait,
+ *         use DELAY_CyclesInline for the shortest delays.
+ * @param  Cycles: Number of the core cycles.
+ * @return None.
+ */
+__RAMFUNC void DELAY_Cycles(uint32_t Cycles)
+{
+    DELAY_CyclesInline(Cycles);
+}
+
+/**
+ * @brief  Busy-wait a number of microseconds measured by MCYCLE.
+ * @note   Recalibrated by CLOCK_Init, so the delay follows the core clock
+ *         changes (see CLOCK_USE_CORE_CLOCK_UPDATE).
+ * @param  Us: Number of microseconds.
+ * @return None.
+ */
+void DELAY_Us(uint32_t Us)
+{
+    uint64_t Cycles, Deadline;
+
+    Cycles = CLOCK_Convert(Us, &CLOCK_Calib.UsToCycles);
+
+    if ((Cycles >> 32) == 0) {
+        DELAY_Cycles((uint32_t)Cycles);
+    } else {
+        Deadline = CLOCK_GetCycles() + Cycles;
+        while (CLOCK_GetCycles() < Deadline) { }
+    }
+}
+
+/**
+ * @brief  Busy-wait a number of milliseconds measured by MTIME.
+ * @note   The machine timer keeps counting when the core clock is gated,
+ *         the resolution is one MTIME tick.
+ * @param  Ms: Number of milliseconds.
+ * @return None.
+ */
+void DELAY_Ms(uint32_t Ms)
+{
+    DELAY_WaitUntil(CLOCK_GetTicks() + CLOCK_NsToTicks((uint64_t)Ms * 1000000UL));
+}
+
+/**
+ * @brief  Busy-wait until the machine time reaches a deadline.
+ * @param  Deadline: Machine time (MTIME) to wait for.
+ * @return None.
+ */
+void DELAY_WaitUntil(uint64_t Deadline)
+{
+    while (CLOCK_GetTicks() < Deadline) { }
+}
+
+/**
+ * @brief  Busy-wait until the core cycle counter reaches a 32-bit time stamp.
+ * @note   The time stamp should be less than 2^31 cycles ahead, it is suitable
+ *         for the periodic waits of the bit-banged protocols:
+ *         Timestamp += Period; DELAY_WaitUntilTimestamp(Timestamp);
+ * @param  Timestamp: Time stamp, see CLOCK_GetTimestamp.
+ * @return None.
+ */
+__RAMFUNC void DELAY_WaitUntilTimestamp(uint32_t Timestamp)
+{
+    while (DELAY_IsTimestampReached(Timestamp) == RESET) { }
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_DELAY_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_DELAY */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_delay.c */
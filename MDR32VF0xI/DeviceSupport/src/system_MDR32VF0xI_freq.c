@@ -0,0 +1,286 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_freq.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the runtime frequency scaling (FREQ) firmware functions.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_freq.h"
+#include "system_MDR32VF0xI_clkcfg.h"
+#include "system_MDR32VF0xI_clock.h"
+#include "system_MDR32VF0xI_swtimer.h"
+#include "system_MDR32VF0xI_it.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_FREQ MDR32VF0xI System FREQ
+ * @{
+ */
+
+#if (CLKTREE_STATIC == 0)
+
+/** @defgroup MDR32VF0xI_System_FREQ_Private_Variables MDR32VF0xI System FREQ Private Variables
+ * @{
+ */
+
+/**
+ * @brief Clock change notifier chain.
+ */
+static FREQ_Notifier_TypeDef* FREQ_Notifiers = NULL;
+
+/**
+ * @brief Duration of the last clock change [ns].
+ */
+static uint32_t FREQ_Latency = 0;
+
+/** @} */ /* End of the group MDR32VF0xI_System_FREQ_Private_Variables */
+
+/** @defgroup MDR32VF0xI_System_FREQ_Private_Functions_Declarations MDR32VF0xI System FREQ Private Functions Declarations
+ * @{
+ */
+
+static void     FREQ_Notify(FREQ_Event_TypeDef Event, uint32_t OldFreq, uint32_t NewFreq);
+static uint32_t FREQ_CyclesToNs(uint32_t Cycles, uint32_t Freq);
+static uint32_t FREQ_Change(const CLKCFG_Config_TypeDef* Config);
+
+/** @} */ /* End of the group MDR32VF0xI_System_FREQ_Private_Functions_Declarations */
+
+/** @addtogroup MDR32VF0xI_System_FREQ_Exported_Functions MDR32VF0xI System FREQ Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Add a driver notifier to the end of the clock change chain.
+ * @param  Notifier: Pointer to the notifier, should stay valid until it is unregistered.
+ * @param  Callback: Clock change callback.
+ * @param  Context: Callback context.
+ * @return None.
+ */
+void FREQ_RegisterNotifier(FREQ_Notifier_TypeDef* Notifier, FREQ_Callback_TypeDef Callback, void* Context)
+{
+    FREQ_Notifier_TypeDef** Link;
+    uint_xlen_t             MStatus;
+
+    /* Check the parameters. */
+    assert_param(Notifier != NULL);
+    assert_param(Callback != NULL);
+
+    Notifier->Next     = NULL;
+    Notifier->Callback = Callback;
+    Notifier->Context  = Context;
+
+    MStatus = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    for (Link = &FREQ_Notifiers; *Link != NULL; Link = &(*Link)->Next) { }
+    *Link = Notifier;
+
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+}
+
+/**
+ * @brief  Remove a driver notifier from the clock change chain.
+ * @note   Should not be called from a clock change callback.
+ * @param  Notifier: Pointer to the notifier.
+ * @return None.
+ */
+void FREQ_UnregisterNotifier(FREQ_Notifier_TypeDef* Notifier)
+{
+    FREQ_Notifier_TypeDef** Link;
+    uint_xlen_t             MStatus;
+
+    /* Check the parameters. */
+    assert_param(Notifier != NULL);
+
+    MStatus = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    for (Link = &FREQ_Notifiers; *Link != NULL; Link = &(*Link)->Next) {
+        if (*Link == Notifier) {
+            *Link = Notifier->Next;
+            break;
+        }
+    }
+
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+}
+
+/**
+ * @brief  Change the core clock to the highest frequency not exceeding
+ *         the target frequency (see SystemClockConfig) and notify the drivers.
+ * @note   The generator is HSE if CLKCFG_USE_HSE is 1, HSI is used if HSE is
+ *         not ready in time. MTIME is clocked by HCLK, so the machine time rate
+ *         changes with the core clock: CLOCK is recalibrated keeping CLOCK_GetNs
+ *         monotonic, the active SWTIMER timers keep their time to expiration.
+ * @param  TargetFreq: Requested core clock frequency [Hz].
+ * @return Achieved core clock frequency [Hz].
+ */
+uint32_t FREQ_SetFrequency(uint32_t TargetFreq)
+{
+    CLKCFG_Config_TypeDef Config;
+    ErrorStatus           Status = ERROR;
+
+#if (CLKCFG_USE_HSE == 1)
+    Status = CLKCFG_Solve(&Config, CLKCFG_SOURCE_HSE, HSE_FREQUENCY_Hz, TargetFreq);
+#endif
+    if (Status == ERROR) {
+        Status = CLKCFG_Solve(&Config, CLKCFG_SOURCE_HSI, SystemHSIClock, TargetFreq);
+    }
+    if (Status == ERROR) {
+        return SystemCoreClock;
+    }
+
+    return FREQ_Change(&Config);
+}
+
+/**
+ * @brief  Change the core clock to LSI for the lowest power and notify the drivers.
+ * @note   LSI should be enabled (it is enabled after reset). The PLL and HSE
+ *         are not stopped, so FREQ_SetFrequency can return to them quickly.
+ * @param  None.
+ * @return Achieved core clock frequency [Hz].
+ */
+uint32_t FREQ_SetLSI(void)
+{
+    return FREQ_Change(NULL);
+}
+
+/**
+ * @brief  Get the duration of the last clock change.
+ * @note   Measured by MCYCLE from the PRE_CHANGE notification to the end of
+ *         the POST_CHANGE notifications, each part is converted with the core
+ *         clock it ran on: the old clock, HSI during the switch, the new clock.
+ * @param  None.
+ * @return Clock change latency [ns].
+ */
+uint32_t FREQ_GetLatency(void)
+{
+    return FREQ_Latency;
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_FREQ_Exported_Functions */
+
+/** @defgroup MDR32VF0xI_System_FREQ_Private_Functions MDR32VF0xI System FREQ Private Functions
+ * @{
+ */
+
+/**
+ * @brief  Call the callbacks of the clock change chain.
+ * @param  Event: @ref FREQ_Event_TypeDef - clock change event.
+ * @param  OldFreq: Core clock frequency before the change [Hz].
+ * @param  NewFreq: Core clock frequency after the change [Hz].
+ * @return None.
+ */
+static void FREQ_Notify(FREQ_Event_TypeDef Event, uint32_t OldFreq, uint32_t NewFreq)
+{
+    FREQ_Notifier_TypeDef* Notifier;
+
+    for (Notifier = FREQ_Notifiers; Notifier != NULL; Notifier = Notifier->Next) {
+        Notifier->Callback(Event, OldFreq, NewFreq, Notifier->Context);
+    }
+}
+
+/**
+ * @brief  Convert a number of the core cycles to nanoseconds.
+ * @param  Cycles: Number of the core cycles.
+ * @param  Freq: Core clock frequency [Hz], not 0.
+ * @return Time [ns].
+ */
+static uint32_t FREQ_CyclesToNs(uint32_t Cycles, uint32_t Freq)
+{
+    return (uint32_t)(((uint64_t)Cycles * 1000000000UL) / Freq);
+}
+
+/**
+ * @brief  Notify the drivers, change the core clock and notify them again.
+ * @note   The FLASH wait states are raised before and lowered after
+ *         the frequency change: CLKCFG_Apply sets them while HCLK is on HSI,
+ *         for LSI they are lowered after the switch.
+ * @param  Config: Pointer to the clock configuration, NULL for LSI.
+ * @return Achieved core clock frequency [Hz].
+ */
+static uint32_t FREQ_Change(const CLKCFG_Config_TypeDef* Config)
+{
+    CLKCFG_Config_TypeDef HSIConfig;
+    uint_xlen_t           MStatus;
+    uint32_t              OldFreq, NewFreq, OldTickFreq;
+    uint32_t              Start, Switch, Switched, End;
+
+    OldFreq     = SystemCoreClock;
+    OldTickFreq = CLOCK_Calib.TickFreq;
+    NewFreq = (Config != NULL) ? Config->Frequency : LSI_FREQUENCY_Hz;
+
+    Start = (uint32_t)csr_read(CSR_MCYCLE);
+
+    FREQ_Notify(FREQ_EVENT_PRE_CHANGE, OldFreq, NewFreq);
+
+    MStatus = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+    Switch  = (uint32_t)csr_read(CSR_MCYCLE);
+
+    if (Config != NULL) {
+        /* On an error HCLK is left on HSI, SystemCoreClockUpdate reports the achieved clock. */
+        if ((CLKCFG_Apply(Config) == ERROR) &&
+            ((Config->CPU_C1Sel == RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSE) || (Config->CPU_C1Sel == RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSE_DIV_2)) &&
+            (CLKCFG_Solve(&HSIConfig, CLKCFG_SOURCE_HSI, SystemHSIClock, Config->Frequency) == SUCCESS)) {
+            /* HSE did not start: fall back to the HSI configuration. */
+            (void)CLKCFG_Apply(&HSIConfig);
+        }
+    } else {
+        MDR_RST_CLK->CPU_CLOCK = (MDR_RST_CLK->CPU_CLOCK & ~RST_CLK_CPU_CLOCK_HCLK_SEL_Msk) | RST_CLK_CPU_CLOCK_HCLK_SEL_LSI;
+        MDR_FLASH->CMD         = (MDR_FLASH->CMD & ~FLASH_CMD_DELAY_Msk) | CLKCFG_GetFlashDelay(LSI_FREQUENCY_Hz);
+    }
+
+    Switched = (uint32_t)csr_read(CSR_MCYCLE);
+    SystemCoreClockUpdate();
+#if (CLOCK_USE_CORE_CLOCK_UPDATE == 0)
+    CLOCK_Init();
+#endif
+    NewFreq = SystemCoreClock;
+    SWTIMER_Rescale(OldTickFreq, CLOCK_Calib.TickFreq);
+
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+
+    FREQ_Notify(FREQ_EVENT_POST_CHANGE, OldFreq, NewFreq);
+
+    End = (uint32_t)csr_read(CSR_MCYCLE);
+
+    /* CLKCFG_Apply polls HSE and the PLL on HSI, the LSI switch is a few cycles. */
+    FREQ_Latency = FREQ_CyclesToNs(Switch - Start, OldFreq) +
+                   FREQ_CyclesToNs(Switched - Switch, (Config != NULL) ? SystemHSIClock : OldFreq) +
+                   FREQ_CyclesToNs(End - Switched, NewFreq);
+
+    return NewFreq;
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_FREQ_Private_Functions */
+
+#endif /* CLKTREE_STATIC == 0 */
+
+/** @} */ /* End of the group MDR32VF0xI_System_FREQ */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_freq.c */
@@ -0,0 +1,255 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_funcprof.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the function profiler (FUNCPROF)
+ *          firmware functions.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_funcprof.h"
+#include "system_MDR32VF0xI_it.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_FUNCPROF MDR32VF0xI System FUNCPROF
+ * @{
+ */
+
+#if (USE_FUNCPROF == 1)
+
+/** @addtogroup MDR32VF0xI_System_FUNCPROF_Exported_Variables MDR32VF0xI System FUNCPROF Exported Variables
+ * @{
+ */
+
+/**
+ * @brief FUNCPROF statistics block.
+ */
+__NOINIT FUNCPROF_Block_TypeDef FUNCPROF_Block;
+
+/** @} */ /* End of the group MDR32VF0xI_System_FUNCPROF_Exported_Variables */
+
+/** @defgroup MDR32VF0xI_System_FUNCPROF_Private_Variables MDR32VF0xI System FUNCPROF Private Variables
+ * @{
+ */
+
+/**
+ * @brief 1 if the hooks record the calls (between FUNCPROF_Init and FUNCPROF_Stop).
+ * @note  Kept in .bss: FUNCPROF_Block.Running survives a warm reset, so it would
+ *        let the instrumented code running before FUNCPROF_Init record into
+ *        the preserved block with its stale call stack.
+ */
+static uint8_t FUNCPROF_Armed = 0;
+
+/** @} */ /* End of the group MDR32VF0xI_System_FUNCPROF_Private_Variables */
+
+/** @defgroup MDR32VF0xI_System_FUNCPROF_Private_Functions MDR32VF0xI System FUNCPROF Private Functions
+ * @{
+ */
+
+/**
+ * @brief  Find the entry of a function, a free entry is taken for a new function.
+ * @note   Open addressing by the multiplicative hash of the address.
+ * @param  Func: Function address.
+ * @return Entry index or FUNCPROF_NO_ENTRY if the table is full.
+ */
+__NO_INSTRUMENT __STATIC_FORCEINLINE uint32_t FUNCPROF_FindEntry(uint32_t Func)
+{
+    FUNCPROF_Entry_TypeDef* Entry;
+    uint32_t                Index, Probe;
+
+    Index = (((Func >> 1) * 0x9E3779B1UL) >> 16) & (FUNCPROF_NUM_ENTRIES - 1);
+
+    for (Probe = 0; Probe < FUNCPROF_NUM_ENTRIES; Probe++) {
+        Entry = &FUNCPROF_Block.Entry[Index];
+        if (Entry->Func == Func) {
+            return Index;
+        }
+        if (Entry->Func == 0) {
+            Entry->Func = Func;
+            return Index;
+        }
+        Index = (Index + 1) & (FUNCPROF_NUM_ENTRIES - 1);
+    }
+
+    return FUNCPROF_NO_ENTRY;
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_FUNCPROF_Private_Functions */
+
+/** @addtogroup MDR32VF0xI_System_FUNCPROF_Exported_Functions MDR32VF0xI System FUNCPROF Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Clear the function profiler statistics and start the recording.
+ * @note   The calls already active are not recorded, their returns are ignored.
+ * @param  ClockFreq: MCYCLE clock frequency [Hz] recorded for the host tool, SystemCoreClock.
+ * @return None.
+ */
+__NO_INSTRUMENT void FUNCPROF_Init(uint32_t ClockFreq)
+{
+    uint_xlen_t MStatus;
+    uint32_t    Index;
+
+    MStatus = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    FUNCPROF_Armed         = 0;
+    FUNCPROF_Block.Magic   = 0;
+    FUNCPROF_Block.Running = 0;
+
+    for (Index = 0; Index < FUNCPROF_NUM_ENTRIES; Index++) {
+        FUNCPROF_Block.Entry[Index].Func       = 0;
+        FUNCPROF_Block.Entry[Index].Calls      = 0;
+        FUNCPROF_Block.Entry[Index].SelfCycles = 0;
+    }
+
+    FUNCPROF_Block.Version    = FUNCPROF_VERSION;
+    FUNCPROF_Block.NumEntries = FUNCPROF_NUM_ENTRIES;
+    FUNCPROF_Block.StackDepth = FUNCPROF_STACK_DEPTH;
+    FUNCPROF_Block.Reserved   = 0;
+    FUNCPROF_Block.ClockFreq  = ClockFreq;
+    FUNCPROF_Block.Calls      = 0;
+    FUNCPROF_Block.Dropped    = 0;
+    FUNCPROF_Block.Overflows  = 0;
+    FUNCPROF_Block.Depth      = 0;
+
+    /* Clear MCOUNTINHIBIT.CY so that MCYCLE counts. */
+    csr_clear_bits(CSR_MCOUNTINHIBIT, 0x1);
+
+    FUNCPROF_Block.Magic   = FUNCPROF_MAGIC;
+    FUNCPROF_Block.Running = 1;
+    FUNCPROF_Armed         = 1;
+
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+}
+
+/**
+ * @brief  Stop the recording, the block can be dumped afterwards.
+ * @param  None.
+ * @return None.
+ */
+__NO_INSTRUMENT void FUNCPROF_Stop(void)
+{
+    FUNCPROF_Armed         = 0;
+    FUNCPROF_Block.Running = 0;
+}
+
+/**
+ * @brief  Function entry hook called by the code built with -finstrument-functions.
+ * @note   Runs with the interrupts disabled, the instrumented interrupt handlers
+ *         nest into the call stack of the interrupted code.
+ * @param  Func: Address of the called function.
+ * @param  CallSite: Return address of the call, not used.
+ * @return None.
+ */
+__NO_INSTRUMENT void __cyg_profile_func_enter(void* Func, void* CallSite)
+{
+    uint32_t                HookCycles = (uint32_t)csr_read(CSR_MCYCLE);
+    uint_xlen_t             MStatus;
+    uint32_t                Index;
+    FUNCPROF_Frame_TypeDef* Frame;
+
+    (void)CallSite;
+
+    if (FUNCPROF_Armed == 0) {
+        return;
+    }
+
+    MStatus = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    Index = FUNCPROF_FindEntry((uint32_t)(uintptr_t)Func);
+    if (Index != FUNCPROF_NO_ENTRY) {
+        FUNCPROF_Block.Entry[Index].Calls++;
+    } else {
+        FUNCPROF_Block.Dropped++;
+    }
+    FUNCPROF_Block.Calls++;
+
+    if (FUNCPROF_Block.Depth < FUNCPROF_STACK_DEPTH) {
+        Frame              = &FUNCPROF_Block.Stack[FUNCPROF_Block.Depth];
+        Frame->Index       = Index;
+        Frame->HookCycles  = HookCycles;
+        Frame->ChildCycles = 0;
+        Frame->EnterCycles = (uint32_t)csr_read(CSR_MCYCLE);
+    } else {
+        FUNCPROF_Block.Overflows++;
+    }
+    FUNCPROF_Block.Depth++;
+
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+}
+
+/**
+ * @brief  Function exit hook called by the code built with -finstrument-functions.
+ * @note   The self cycles of the function are added to its entry, the whole call
+ *         with the hooks is added to the child cycles of the caller.
+ * @param  Func: Address of the returning function, not used.
+ * @param  CallSite: Return address of the call, not used.
+ * @return None.
+ */
+__NO_INSTRUMENT void __cyg_profile_func_exit(void* Func, void* CallSite)
+{
+    uint32_t                ExitCycles = (uint32_t)csr_read(CSR_MCYCLE);
+    uint_xlen_t             MStatus;
+    FUNCPROF_Frame_TypeDef* Frame;
+
+    (void)Func;
+    (void)CallSite;
+
+    if (FUNCPROF_Armed == 0) {
+        return;
+    }
+
+    MStatus = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    /* The calls active at FUNCPROF_Init return at the depth 0. */
+    if (FUNCPROF_Block.Depth != 0) {
+        FUNCPROF_Block.Depth--;
+        if (FUNCPROF_Block.Depth < FUNCPROF_STACK_DEPTH) {
+            Frame = &FUNCPROF_Block.Stack[FUNCPROF_Block.Depth];
+            if (Frame->Index != FUNCPROF_NO_ENTRY) {
+                FUNCPROF_Block.Entry[Frame->Index].SelfCycles += (ExitCycles - Frame->EnterCycles) - Frame->ChildCycles;
+            }
+            if (FUNCPROF_Block.Depth != 0) {
+                FUNCPROF_Block.Stack[FUNCPROF_Block.Depth - 1].ChildCycles += (uint32_t)csr_read(CSR_MCYCLE) - Frame->HookCycles;
+            }
+        }
+    }
+
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_FUNCPROF_Exported_Functions */
+
+#endif /* USE_FUNCPROF == 1 */
+
+/** @} */ /* End of the group MDR32VF0xI_System_FUNCPROF */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_funcprof.c */
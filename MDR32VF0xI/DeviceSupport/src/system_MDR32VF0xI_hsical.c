@@ -0,0 +1,420 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_hsical.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the HSI calibration (HSICAL) firmware functions.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_hsical.h"
+#include "system_MDR32VF0xI_clock.h"
+#include "system_MDR32VF0xI_swtimer.h"
+#include "system_MDR32VF0xI_it.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_HSICAL MDR32VF0xI System HSICAL
+ * @{
+ */
+
+/** @defgroup MDR32VF0xI_System_HSICAL_Private_Defines MDR32VF0xI System HSICAL Private Defines
+ * @{
+ */
+
+/**
+ * @brief BKP and RTC registers write access key (BKP WPR).
+ */
+#define HSICAL_BKP_WPR_KEY ((uint32_t)0x8555AAA1)
+
+/**
+ * @brief RST_CLK RTC_CLOCK HSE_SEL value for HSE_RTC = HSE / 256
+ *        (1xxx - division by 2^(xxx + 1)).
+ */
+#define HSICAL_HSE_RTC_SEL ((uint32_t)0xF)
+
+/**
+ * @brief Number of the polling iterations to wait for a reference clock edge,
+ *        HSE_RDY or the RTC write completion.
+ */
+#define HSICAL_TIMEOUT ((uint32_t)0x00010000)
+
+/** @} */ /* End of the group MDR32VF0xI_System_HSICAL_Private_Defines */
+
+/** @defgroup MDR32VF0xI_System_HSICAL_Private_Functions_Declarations MDR32VF0xI System HSICAL Private Functions Declarations
+ * @{
+ */
+
+static uint32_t    HSICAL_ReadRTCDiv(void);
+static ErrorStatus HSICAL_WaitRTCWrite(void);
+static uint32_t    HSICAL_Distance(uint32_t Freq);
+#if (CLKTREE_STATIC == 0)
+static void        HSICAL_Recalibrate(uint32_t CoreClock);
+#endif
+
+/** @} */ /* End of the group MDR32VF0xI_System_HSICAL_Private_Functions_Declarations */
+
+/** @addtogroup MDR32VF0xI_System_HSICAL_Exported_Functions MDR32VF0xI System HSICAL Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Compute the HSI frequency from a number of the HSI cycles counted
+ *         during a number of the reference clock periods.
+ * @note   Pure function, does not access the hardware.
+ * @param  Cycles: Number of the HSI cycles.
+ * @param  RefTicks: Number of the reference clock periods, not 0.
+ * @param  RefFreq: Reference clock frequency [Hz].
+ * @return HSI frequency [Hz], rounded to the nearest.
+ */
+uint32_t HSICAL_ComputeFreq(uint32_t Cycles, uint32_t RefTicks, uint32_t RefFreq)
+{
+    /* Check the parameters. */
+    assert_param(RefTicks != 0);
+
+    return (uint32_t)(((uint64_t)Cycles * RefFreq + (RefTicks / 2)) / RefTicks);
+}
+
+/**
+ * @brief  Get the HSI trim value.
+ * @param  None.
+ * @return HSI trim, 0..HSICAL_TRIM_MAX.
+ */
+uint32_t HSICAL_GetTrim(void)
+{
+    return (MDR_BKP->CLK & BKP_CLK_HSI_TRIM_Msk) >> BKP_CLK_HSI_TRIM_Pos;
+}
+
+/**
+ * @brief  Set the HSI trim value.
+ * @note   SystemHSIClock is not changed, use HSICAL_Measure or HSICAL_Calibrate.
+ *         The BKP write protection of the caller is restored.
+ * @param  Trim: HSI trim, 0..HSICAL_TRIM_MAX.
+ * @return None.
+ */
+void HSICAL_SetTrim(uint32_t Trim)
+{
+    uint32_t WriteProtection;
+
+    /* Check the parameters. */
+    assert_param(Trim <= HSICAL_TRIM_MAX);
+
+    WriteProtection = MDR_BKP->WPR;
+    MDR_BKP->WPR    = HSICAL_BKP_WPR_KEY;
+    MDR_BKP->CLK    = (MDR_BKP->CLK & ~BKP_CLK_HSI_TRIM_Msk) | (Trim << BKP_CLK_HSI_TRIM_Pos);
+    MDR_BKP->WPR    = WriteProtection;
+}
+
+#if defined(USE_MDR32F02)
+/**
+ * @brief  Set the HSI trim to the factory value of the OTP HSI_TRIM field.
+ * @param  None.
+ * @return @ref ErrorStatus - SUCCESS if the field is programmed, ERROR otherwise.
+ */
+ErrorStatus HSICAL_LoadFactoryTrim(void)
+{
+    uint32_t Trim = OTP_SPECIAL_FIELDS->HSI_TRIM;
+
+    if (Trim == 0xFFFFFFFFUL) {
+        return ERROR;
+    }
+
+    HSICAL_SetTrim(Trim & HSICAL_TRIM_MAX);
+
+    return SUCCESS;
+}
+#endif
+
+/**
+ * @brief  Measure the HSI frequency against LSE or HSE.
+ * @note   HCLK is switched to HSI for the measurement, so MCYCLE counts
+ *         the HSI cycles, and the RTC prescaler counter is clocked by
+ *         the reference clock. The edges of the counter gate the MCYCLE count.
+ *         HCLK, the RTC clock selection, the RTC prescaler reload, the BKP
+ *         write protection and HSE (if started here) are restored afterwards,
+ *         the RTC prescaler counter is not, so the measurement is refused
+ *         if the RTC is enabled (it would lose the time of a running calendar).
+ *         MTIME is clocked by HCLK: CLOCK is recalibrated to SystemHSIClock
+ *         after the switch to HSI and back after the restore, and the active
+ *         SWTIMER timers are rescaled each time, so CLOCK_GetNs stays monotonic
+ *         (with CLKTREE_STATIC = 1 the calibration is a constant and
+ *         the CLOCK time loses the difference during the measurement).
+ *         The interrupts are disabled during the measurement
+ *         (RefTicks / 32768 s for LSE).
+ * @param  Ref: @ref HSICAL_Ref_TypeDef - reference clock, should be running
+ *         (LSE_RDY) or startable (HSE).
+ * @param  RefTicks: Number of the reference clock periods to measure, not 0.
+ *         The resolution is 1 / RefTicks of the reference period.
+ * @return HSI frequency [Hz], 0 if the reference clock is not running
+ *         or the RTC is enabled (BKP RTC_CR RTC_EN).
+ */
+uint32_t HSICAL_Measure(HSICAL_Ref_TypeDef Ref, uint32_t RefTicks)
+{
+    uint_xlen_t MStatus;
+    uint32_t    CPUClock, RTCClock, RTCControl, RTCReload, WriteProtection, HSControl;
+    uint32_t    RefFreq, RTCSel, Prev, Cur, Count, Timeout;
+#if (CLKTREE_STATIC == 0)
+    uint32_t    CoreClock;
+#endif
+    uint32_t    Start = 0, Cycles = 0;
+
+    /* Check the parameters. */
+    assert_param(IS_HSICAL_REF(Ref));
+    assert_param(RefTicks != 0);
+
+    if ((MDR_BKP->RTC_CR & BKP_RTC_CR_RTC_EN_Msk) != 0) {
+        return 0;
+    }
+
+    HSControl = MDR_RST_CLK->HS_CONTROL;
+
+    if (Ref == HSICAL_REF_LSE) {
+        if ((MDR_BKP->CLK & BKP_CLK_LSE_RDY) == 0) {
+            return 0;
+        }
+        RefFreq = LSE_FREQUENCY_Hz;
+        RTCSel  = BKP_RTC_CR_RTC_SEL_LSE;
+    } else {
+        if ((MDR_RST_CLK->CLOCK_STATUS & RST_CLK_CLOCK_STATUS_HSE_RDY) == 0) {
+#if (HSE_EXT_GEN_MODE == 1)
+            MDR_RST_CLK->HS_CONTROL = RST_CLK_HS_CONTROL_HSE_ON | RST_CLK_HS_CONTROL_HSE_BYP;
+#else
+            MDR_RST_CLK->HS_CONTROL = RST_CLK_HS_CONTROL_HSE_ON;
+#endif
+            for (Timeout = HSICAL_TIMEOUT; (MDR_RST_CLK->CLOCK_STATUS & RST_CLK_CLOCK_STATUS_HSE_RDY) == 0; Timeout--) {
+                if (Timeout == 0) {
+                    MDR_RST_CLK->HS_CONTROL = HSControl;
+                    return 0;
+                }
+            }
+        }
+        RefFreq = HSE_FREQUENCY_Hz >> 8;
+        RTCSel  = BKP_RTC_CR_RTC_SEL_HSE_RTC;
+    }
+
+    MStatus = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    CPUClock   = MDR_RST_CLK->CPU_CLOCK;
+    RTCClock   = MDR_RST_CLK->RTC_CLOCK;
+    RTCControl = MDR_BKP->RTC_CR;
+    RTCReload  = MDR_BKP->RTC_PRL;
+
+    WriteProtection = MDR_BKP->WPR;
+
+    /* HSI is the lowest HCLK, the FLASH wait states are valid. */
+    MDR_RST_CLK->CPU_CLOCK = (CPUClock & ~RST_CLK_CPU_CLOCK_HCLK_SEL_Msk) | RST_CLK_CPU_CLOCK_HCLK_SEL_HSI;
+#if (CLKTREE_STATIC == 0)
+    CoreClock = SystemCoreClock;
+    HSICAL_Recalibrate(SystemHSIClock);
+#endif
+    if (Ref == HSICAL_REF_HSE) {
+        MDR_RST_CLK->RTC_CLOCK = (RTCClock & ~RST_CLK_RTC_CLOCK_HSE_SEL_Msk) |
+                                 (HSICAL_HSE_RTC_SEL << RST_CLK_RTC_CLOCK_HSE_SEL_Pos) | RST_CLK_RTC_CLOCK_HSE_RTC_EN_Msk;
+    }
+
+    MDR_BKP->WPR     = HSICAL_BKP_WPR_KEY;
+    MDR_BKP->RTC_CR  = (RTCControl & ~BKP_RTC_CR_RTC_SEL_Msk) | RTCSel | BKP_RTC_CR_RTC_EN_Msk;
+    MDR_BKP->RTC_PRL = BKP_RTC_PRL_RTC_PRL_Msk;
+
+    if (HSICAL_WaitRTCWrite() == SUCCESS) {
+        /* Count RefTicks reference periods from the first counter edge. */
+        Count   = 0;
+        Timeout = HSICAL_TIMEOUT;
+        Prev    = HSICAL_ReadRTCDiv();
+        while (Count <= RefTicks) {
+            Cur = HSICAL_ReadRTCDiv();
+            if (Cur != Prev) {
+                if (Count == 0) {
+                    Start = (uint32_t)csr_read(CSR_MCYCLE);
+                }
+                Prev    = Cur;
+                Timeout = HSICAL_TIMEOUT;
+                Count++;
+            } else if (--Timeout == 0) {
+                break;
+            }
+        }
+        if (Count > RefTicks) {
+            Cycles = (uint32_t)csr_read(CSR_MCYCLE) - Start;
+        }
+    }
+
+    MDR_BKP->RTC_PRL = RTCReload;
+    (void)HSICAL_WaitRTCWrite();
+    MDR_BKP->RTC_CR = RTCControl;
+    MDR_BKP->WPR    = WriteProtection;
+
+    MDR_RST_CLK->RTC_CLOCK  = RTCClock;
+    MDR_RST_CLK->CPU_CLOCK  = CPUClock;
+    MDR_RST_CLK->HS_CONTROL = HSControl;
+#if (CLKTREE_STATIC == 0)
+    HSICAL_Recalibrate(CoreClock);
+#endif
+
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+
+    if (Cycles == 0) {
+        return 0;
+    }
+
+    return HSICAL_ComputeFreq(Cycles, RefTicks, RefFreq);
+}
+
+/**
+ * @brief  Trim HSI to HSI_FREQUENCY_Hz and publish the measured frequency.
+ * @note   The search starts from the factory trim on MDR32F02 (if programmed),
+ *         from the current trim otherwise, and steps the trim in the direction
+ *         reducing the error until it grows, so it does not depend on
+ *         the trim slope. SystemHSIClock is set to the measured frequency
+ *         of the selected trim and SystemCoreClockUpdate is called, so
+ *         SystemCoreClock and the clock solvers use it, CLOCK is recalibrated
+ *         and the active SWTIMER timers are rescaled.
+ *         Should be called before the peripheral dividers are computed.
+ * @param  Ref: @ref HSICAL_Ref_TypeDef - reference clock.
+ * @param  RefTicks: Number of the reference clock periods per measurement.
+ * @return @ref ErrorStatus - SUCCESS if HSI is measured, ERROR if the reference
+ *         clock is not running or the RTC is enabled (the trim and SystemHSIClock
+ *         are not changed).
+ */
+ErrorStatus HSICAL_Calibrate(HSICAL_Ref_TypeDef Ref, uint32_t RefTicks)
+{
+    uint32_t InitTrim, BestTrim, BestFreq, Trim, Freq, OldTickFreq;
+    int32_t  Step;
+
+    InitTrim = HSICAL_GetTrim();
+
+#if defined(USE_MDR32F02)
+    (void)HSICAL_LoadFactoryTrim();
+#endif
+
+    BestTrim = HSICAL_GetTrim();
+    BestFreq = HSICAL_Measure(Ref, RefTicks);
+    if (BestFreq == 0) {
+        HSICAL_SetTrim(InitTrim);
+        return ERROR;
+    }
+
+    for (Step = 1; Step >= -1; Step -= 2) {
+        Trim = BestTrim;
+        while (((Step > 0) && (Trim < HSICAL_TRIM_MAX)) || ((Step < 0) && (Trim > 0))) {
+            Trim = (uint32_t)((int32_t)Trim + Step);
+            HSICAL_SetTrim(Trim);
+            Freq = HSICAL_Measure(Ref, RefTicks);
+            if ((Freq == 0) || (HSICAL_Distance(Freq) >= HSICAL_Distance(BestFreq))) {
+                break;
+            }
+            BestTrim = Trim;
+            BestFreq = Freq;
+        }
+    }
+
+    HSICAL_SetTrim(BestTrim);
+
+    OldTickFreq    = CLOCK_Calib.TickFreq;
+    SystemHSIClock = BestFreq;
+    SystemCoreClockUpdate();
+#if (CLOCK_USE_CORE_CLOCK_UPDATE == 0)
+    CLOCK_Init();
+#endif
+    SWTIMER_Rescale(OldTickFreq, CLOCK_Calib.TickFreq);
+
+    return SUCCESS;
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_HSICAL_Exported_Functions */
+
+/** @defgroup MDR32VF0xI_System_HSICAL_Private_Functions MDR32VF0xI System HSICAL Private Functions
+ * @{
+ */
+
+/**
+ * @brief  Read the RTC prescaler counter, clocked asynchronously.
+ * @param  None.
+ * @return RTC prescaler counter value.
+ */
+static uint32_t HSICAL_ReadRTCDiv(void)
+{
+    uint32_t Value;
+
+    do {
+        Value = MDR_BKP->RTC_PREDIV_S;
+    } while (Value != MDR_BKP->RTC_PREDIV_S);
+
+    return Value;
+}
+
+/**
+ * @brief  Wait for the completion of the RTC registers write.
+ * @param  None.
+ * @return @ref ErrorStatus - SUCCESS if the write is completed, ERROR on timeout.
+ */
+static ErrorStatus HSICAL_WaitRTCWrite(void)
+{
+    uint32_t Count = HSICAL_TIMEOUT;
+
+    while ((MDR_BKP->RTC_CS & BKP_RTC_CS_WEC_Msk) != 0) {
+        if (Count-- == 0) {
+            return ERROR;
+        }
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * @brief  Get the distance of a frequency from HSI_FREQUENCY_Hz.
+ * @param  Freq: Frequency [Hz].
+ * @return Absolute difference [Hz].
+ */
+static uint32_t HSICAL_Distance(uint32_t Freq)
+{
+    return (Freq > HSI_FREQUENCY_Hz) ? (Freq - HSI_FREQUENCY_Hz) : (HSI_FREQUENCY_Hz - Freq);
+}
+
+#if (CLKTREE_STATIC == 0)
+/**
+ * @brief  Recalibrate CLOCK to a new core clock and rescale the active
+ *         SWTIMER timers to the new machine timer frequency.
+ * @param  CoreClock: Core clock (HCLK) frequency [Hz].
+ * @return None.
+ */
+static void HSICAL_Recalibrate(uint32_t CoreClock)
+{
+    uint32_t OldTickFreq = CLOCK_Calib.TickFreq;
+
+    SystemCoreClock = CoreClock;
+    CLOCK_Init();
+    SWTIMER_Rescale(OldTickFreq, CLOCK_Calib.TickFreq);
+}
+#endif
+
+/** @} */ /* End of the group MDR32VF0xI_System_HSICAL_Private_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_HSICAL */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_hsical.c */
@@ -0,0 +1,213 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_idle.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the tickless idle manager (IDLE) firmware functions.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_idle.h"
+#include "system_MDR32VF0xI_clock.h"
+#include "system_MDR32VF0xI_swtimer.h"
+#include "system_MDR32VF0xI_it.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_IDLE MDR32VF0xI System IDLE
+ * @{
+ */
+
+/** @defgroup MDR32VF0xI_System_IDLE_Private_Variables MDR32VF0xI System IDLE Private Variables
+ * @{
+ */
+
+/**
+ * @brief Low-power sleep function, NULL if only WFI is used.
+ */
+static IDLE_SleepFunc_TypeDef IDLE_SleepFunc = NULL;
+
+/**
+ * @brief Minimum time to the next deadline to use the low-power sleep function [MTIME ticks].
+ */
+static uint64_t IDLE_SleepMinTicks = 0;
+
+/**
+ * @brief Idle statistics.
+ */
+static IDLE_Stats_TypeDef IDLE_Stats;
+
+/**
+ * @brief Machine time and idle time at the previous IDLE_GetLoad call.
+ */
+static uint64_t IDLE_LoadTime;
+static uint64_t IDLE_LoadIdleTicks;
+
+/** @} */ /* End of the group MDR32VF0xI_System_IDLE_Private_Variables */
+
+/** @addtogroup MDR32VF0xI_System_IDLE_Exported_Functions MDR32VF0xI System IDLE Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the idle manager: clear the statistics and start
+ *         the load measurement window.
+ * @note   Should be called after SWTIMER_Init.
+ * @param  None.
+ * @return None.
+ */
+void IDLE_Init(void)
+{
+    IDLE_Stats.IdleTicks  = 0;
+    IDLE_Stats.SleepTicks = 0;
+    IDLE_Stats.WFICount   = 0;
+    IDLE_Stats.SleepCount = 0;
+
+    IDLE_LoadTime      = CLOCK_GetTicks();
+    IDLE_LoadIdleTicks = 0;
+}
+
+/**
+ * @brief  Set the low-power sleep function used for the long idle periods.
+ * @param  SleepFunc: Sleep function, NULL to use only WFI.
+ * @param  MinTicks: Minimum time to the next software timer deadline
+ *         to use the sleep function (its entry and exit cost) [MTIME ticks].
+ * @return None.
+ */
+void IDLE_SetSleepFunc(IDLE_SleepFunc_TypeDef SleepFunc, uint64_t MinTicks)
+{
+    uint_xlen_t MStatus;
+
+    MStatus = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    IDLE_SleepFunc     = SleepFunc;
+    IDLE_SleepMinTicks = MinTicks;
+
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+}
+
+/**
+ * @brief  Idle until the next interrupt, called by the main loop when there
+ *         is no work (race to idle).
+ * @note   The interrupts are disabled from the deadline check to the wakeup,
+ *         so a wakeup event can not be lost: WFI returns on a pending interrupt,
+ *         which is taken when the interrupts are enabled again.
+ *         There is no periodic tick: the machine timer compare is kept at the
+ *         next software timer deadline by SWTIMER.
+ *         If the time to the deadline is at least MinTicks, the sleep function
+ *         is used and MTIME, stopped in the low-power mode, is advanced
+ *         by the time it returns, so CLOCK and SWTIMER keep the time.
+ * @param  None.
+ * @return None.
+ */
+void IDLE_Enter(void)
+{
+    uint_xlen_t MStatus;
+    uint64_t    Start, End, Deadline, Slept;
+
+    MStatus = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    Start    = CLOCK_GetTicks();
+    Deadline = SWTIMER_GetNextDeadline();
+
+    if ((IDLE_SleepFunc != NULL) && (Deadline > Start) && ((Deadline - Start) >= IDLE_SleepMinTicks)) {
+        Slept = IDLE_SleepFunc(Deadline - Start);
+        End   = CLOCK_GetTicks();
+
+        /* Compensate the time MTIME did not count. */
+        if (Slept > (End - Start)) {
+            End = Start + Slept;
+            CLINT_MTIMER_SetTime(End);
+        }
+
+        IDLE_Stats.SleepTicks += End - Start;
+        IDLE_Stats.SleepCount++;
+    } else {
+        __WFI();
+        End = CLOCK_GetTicks();
+
+        IDLE_Stats.WFICount++;
+    }
+
+    IDLE_Stats.IdleTicks += End - Start;
+
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+}
+
+/**
+ * @brief  Get the idle statistics.
+ * @param  Stats: Pointer to the statistics to fill.
+ * @return None.
+ */
+void IDLE_GetStats(IDLE_Stats_TypeDef* Stats)
+{
+    uint_xlen_t MStatus;
+
+    /* Check the parameters. */
+    assert_param(Stats != NULL);
+
+    MStatus = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+    *Stats  = IDLE_Stats;
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+}
+
+/**
+ * @brief  Get the CPU load since the previous call (or IDLE_Init)
+ *         and start a new measurement window.
+ * @note   Busy time is the window time not spent in IDLE_Enter.
+ * @param  None.
+ * @return CPU load [per mille], 0..1000.
+ */
+uint32_t IDLE_GetLoad(void)
+{
+    uint_xlen_t MStatus;
+    uint64_t    Now, Elapsed, Idle;
+
+    MStatus = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    Now     = CLOCK_GetTicks();
+    Elapsed = Now - IDLE_LoadTime;
+    Idle    = IDLE_Stats.IdleTicks - IDLE_LoadIdleTicks;
+
+    IDLE_LoadTime      = Now;
+    IDLE_LoadIdleTicks = IDLE_Stats.IdleTicks;
+
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+
+    if ((Elapsed == 0) || (Idle >= Elapsed)) {
+        return 0;
+    }
+
+    return (uint32_t)(((Elapsed - Idle) * 1000U) / Elapsed);
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_IDLE_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_IDLE */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_idle.c */
@@ -0,0 +1,216 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_irqmod.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the adaptive interrupt moderation (IRQMOD)
+ *          firmware functions.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_irqmod.h"
+#include "system_MDR32VF0xI_ic.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_IRQMOD MDR32VF0xI System IRQMOD
+ * @{
+ */
+
+/** @defgroup MDR32VF0xI_System_IRQMOD_Private_Variables MDR32VF0xI System IRQMOD Private Variables
+ * @{
+ */
+
+/**
+ * @brief Registered sources.
+ */
+static IRQMOD_Source_TypeDef* IRQMOD_SourceList = NULL;
+
+/**
+ * @brief Rate measurement window [MTIME ticks].
+ */
+static uint32_t IRQMOD_WindowTicks = 1;
+
+/** @} */ /* End of the group MDR32VF0xI_System_IRQMOD_Private_Variables */
+
+/** @defgroup MDR32VF0xI_System_IRQMOD_Private_Functions MDR32VF0xI System IRQMOD Private Functions
+ * @{
+ */
+
+/**
+ * @brief  Get the lower 32 bits of MTIME.
+ * @note   Enough for windows shorter than 2^31 ticks, a single bus access.
+ * @param  None.
+ * @return MTIME lower 32 bits.
+ */
+__STATIC_INLINE uint32_t IRQMOD_GetTime(void)
+{
+    return *(volatile uint32_t*)(MTIME_BASE);
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_IRQMOD_Private_Functions */
+
+/** @addtogroup MDR32VF0xI_System_IRQMOD_Exported_Functions MDR32VF0xI System IRQMOD Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the interrupt moderation.
+ * @param  WindowTicks: Rate measurement window [MTIME ticks], from 1 to 0x7FFFFFFF.
+ * @return None.
+ */
+void IRQMOD_Init(uint32_t WindowTicks)
+{
+    /* Check the parameters. */
+    assert_param((WindowTicks != 0) && (WindowTicks <= 0x7FFFFFFFUL));
+
+    IRQMOD_SourceList  = NULL;
+    IRQMOD_WindowTicks = WindowTicks;
+}
+
+/**
+ * @brief  Initialize a moderated source and register it for IRQMOD_Poll.
+ * @note   Should be called before the source interrupt is enabled.
+ * @param  Source: Pointer to the source control block.
+ * @param  IRQn: Device specific interrupt number of the source.
+ * @param  HighThreshold: Interrupts per window above which the source
+ *         is switched to the polling mode.
+ * @param  LowThreshold: Polled events per window below which the source
+ *         is switched back to the interrupt mode, should be lower than HighThreshold.
+ * @param  PollFunc: Function servicing the source in the polling mode.
+ * @param  Arg: Poll function argument.
+ * @return None.
+ */
+void IRQMOD_InitSource(IRQMOD_Source_TypeDef* Source, IRQn_TypeDef IRQn, uint32_t HighThreshold, uint32_t LowThreshold,
+                       IRQMOD_PollFunc_TypeDef PollFunc, void* Arg)
+{
+    /* Check the parameters. */
+    assert_param(IS_IRQ(IRQn));
+    assert_param(LowThreshold < HighThreshold);
+    assert_param(PollFunc != NULL);
+
+    Source->IRQn          = IRQn;
+    Source->HighThreshold = HighThreshold;
+    Source->LowThreshold  = LowThreshold;
+    Source->PollFunc      = PollFunc;
+    Source->Arg           = Arg;
+    Source->Mode          = IRQMOD_MODE_IRQ;
+    Source->WindowStart   = IRQMOD_GetTime();
+    Source->WindowEvents  = 0;
+
+    Source->Stats.IRQEvents   = 0;
+    Source->Stats.PollEvents  = 0;
+    Source->Stats.ToPolling   = 0;
+    Source->Stats.ToInterrupt = 0;
+
+    Source->Next      = IRQMOD_SourceList;
+    IRQMOD_SourceList = Source;
+}
+
+/**
+ * @brief  Count an interrupt of a moderated source.
+ * @note   Should be called from the source interrupt handler. When the rate
+ *         exceeds HighThreshold the source interrupt is disabled and the
+ *         source is serviced by IRQMOD_Poll until the rate drops below LowThreshold.
+ * @param  Source: Pointer to the source control block.
+ * @return @ref IRQMOD_Mode_TypeDef - mode after the interrupt is counted.
+ */
+IRQMOD_Mode_TypeDef IRQMOD_CountIRQ(IRQMOD_Source_TypeDef* Source)
+{
+    uint32_t Now = IRQMOD_GetTime();
+
+    Source->Stats.IRQEvents++;
+
+    if ((Now - Source->WindowStart) >= IRQMOD_WindowTicks) {
+        Source->WindowStart  = Now;
+        Source->WindowEvents = 0;
+    }
+
+    Source->WindowEvents++;
+    if (Source->WindowEvents > Source->HighThreshold) {
+        IC_DisableIRQ(Source->IRQn);
+        Source->Mode         = IRQMOD_MODE_POLL;
+        Source->WindowStart  = Now;
+        Source->WindowEvents = 0;
+        Source->Stats.ToPolling++;
+    }
+
+    return Source->Mode;
+}
+
+/**
+ * @brief  Service the sources in the polling mode.
+ * @note   Should be called periodically (from a timer interrupt handler or
+ *         the main loop) with a period shorter than the window.
+ *         Must not be preempted by the handlers of the moderated sources.
+ * @param  None.
+ * @return None.
+ */
+void IRQMOD_Poll(void)
+{
+    IRQMOD_Source_TypeDef* Source;
+    uint32_t               Now, Events;
+
+    for (Source = IRQMOD_SourceList; Source != NULL; Source = Source->Next) {
+        if (Source->Mode != IRQMOD_MODE_POLL) {
+            continue;
+        }
+
+        Events = Source->PollFunc(Source->Arg);
+        Source->Stats.PollEvents += Events;
+        Source->WindowEvents += Events;
+
+        Now = IRQMOD_GetTime();
+        if ((Now - Source->WindowStart) >= IRQMOD_WindowTicks) {
+            if (Source->WindowEvents < Source->LowThreshold) {
+                Source->Mode = IRQMOD_MODE_IRQ;
+                Source->Stats.ToInterrupt++;
+                IC_EnableIRQ(Source->IRQn);
+            }
+            Source->WindowStart  = Now;
+            Source->WindowEvents = 0;
+        }
+    }
+}
+
+/**
+ * @brief  Get the statistics of a moderated source.
+ * @param  Source: Pointer to the source control block.
+ * @param  Stats: Pointer to the @ref IRQMOD_Stats_TypeDef structure to fill.
+ * @return None.
+ */
+void IRQMOD_GetStats(const IRQMOD_Source_TypeDef* Source, IRQMOD_Stats_TypeDef* Stats)
+{
+    *Stats = Source->Stats;
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_IRQMOD_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_IRQMOD */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_irqmod.c */
@@ -0,0 +1,200 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_irqprof.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the interrupt latency and duration profiler
+ *          (IRQPROF) firmware functions.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_irqprof.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_IRQPROF MDR32VF0xI System IRQPROF
+ * @{
+ */
+
+#if (IT_USE_PROFILE == 1)
+
+/** @addtogroup MDR32VF0xI_System_IRQPROF_Exported_Variables MDR32VF0xI System IRQPROF Exported Variables
+ * @{
+ */
+
+/**
+ * @brief IRQPROF statistics block.
+ */
+__NOINIT IRQPROF_Block_TypeDef IRQPROF_Block;
+
+/** @} */ /* End of the group MDR32VF0xI_System_IRQPROF_Exported_Variables */
+
+/** @defgroup MDR32VF0xI_System_IRQPROF_Private_Functions MDR32VF0xI System IRQPROF Private Functions
+ * @{
+ */
+
+/**
+ * @brief  Add a value to a log2 histogram and update the minimum and maximum.
+ * @param  Value: Value to add.
+ * @param  Min: Pointer to the minimum.
+ * @param  Max: Pointer to the maximum.
+ * @param  Hist: Histogram of IRQPROF_HIST_BINS bins.
+ * @return None.
+ */
+__STATIC_INLINE void IRQPROF_AddValue(uint32_t Value, uint32_t* Min, uint32_t* Max, uint16_t* Hist)
+{
+    uint32_t Bin = 0, Rest = Value;
+
+    while ((Rest != 0) && (Bin < (IRQPROF_HIST_BINS - 1))) {
+        Rest >>= 1;
+        Bin++;
+    }
+
+    if (Hist[Bin] != 0xFFFF) {
+        Hist[Bin]++;
+    }
+    if (Value < *Min) {
+        *Min = Value;
+    }
+    if (Value > *Max) {
+        *Max = Value;
+    }
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_IRQPROF_Private_Functions */
+
+/** @addtogroup MDR32VF0xI_System_IRQPROF_Exported_Functions MDR32VF0xI System IRQPROF Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the interrupt profiler.
+ * @note   The statistics kept in the .noinit block over a warm reset are
+ *         preserved if the block is valid and has the same layout,
+ *         the block is cleared otherwise. Should be called before the interrupts are enabled.
+ * @param  ClockFreq: Time stamp clock frequency [Hz] recorded for the host decoder:
+ *         SystemCoreClock for MCYCLE, the CLINT timer frequency for MTIME.
+ * @return None.
+ */
+void IRQPROF_Init(uint32_t ClockFreq)
+{
+    if ((IRQPROF_Block.Magic != IRQPROF_MAGIC) ||
+        (IRQPROF_Block.Version != IRQPROF_VERSION) ||
+        (IRQPROF_Block.NumEntries != IRQPROF_NUM_ENTRIES) ||
+        (IRQPROF_Block.HistBins != IRQPROF_HIST_BINS) ||
+        (IRQPROF_Block.Clock != IT_PROFILE_CLOCK) ||
+        (IRQPROF_Block.ExtOffset != IRQPROF_EXT_OFFSET)) {
+        IRQPROF_Reset();
+    }
+
+    IRQPROF_Block.ClockFreq = ClockFreq;
+
+#if (IT_PROFILE_CLOCK == 0)
+    /* Clear MCOUNTINHIBIT.CY so that MCYCLE counts. */
+    csr_clear_bits(CSR_MCOUNTINHIBIT, 0x1);
+#endif
+}
+
+/**
+ * @brief  Clear the interrupt profiler statistics.
+ * @param  None.
+ * @return None.
+ */
+void IRQPROF_Reset(void)
+{
+    IRQPROF_Entry_TypeDef* Entry;
+    uint32_t               Index, Bin;
+
+    IRQPROF_Block.Magic = 0;
+
+    for (Index = 0; Index < IRQPROF_NUM_ENTRIES; Index++) {
+        Entry              = &IRQPROF_Block.Entry[Index];
+        Entry->Count       = 0;
+        Entry->LatencyMin  = 0xFFFFFFFF;
+        Entry->LatencyMax  = 0;
+        Entry->DurationMin = 0xFFFFFFFF;
+        Entry->DurationMax = 0;
+        for (Bin = 0; Bin < IRQPROF_HIST_BINS; Bin++) {
+            Entry->LatencyHist[Bin]  = 0;
+            Entry->DurationHist[Bin] = 0;
+        }
+    }
+
+    IRQPROF_Block.Version    = IRQPROF_VERSION;
+    IRQPROF_Block.NumEntries = IRQPROF_NUM_ENTRIES;
+    IRQPROF_Block.HistBins   = IRQPROF_HIST_BINS;
+    IRQPROF_Block.Clock      = IT_PROFILE_CLOCK;
+    IRQPROF_Block.ExtOffset  = IRQPROF_EXT_OFFSET;
+    IRQPROF_Block.Reserved   = 0;
+    __COMPILER_BARRIER();
+    IRQPROF_Block.Magic = IRQPROF_MAGIC;
+}
+
+/**
+ * @brief  Record a handler call, called by the trap dispatcher.
+ * @note   Entries of different interrupts are independent, so a nested
+ *         interrupt can be recorded while a lower priority one is recorded.
+ * @param  Index: Statistics entry index, see IRQPROF_NUM_ENTRIES.
+ * @param  EntryTime: Time stamp of the trap dispatcher entry.
+ * @param  StartTime: Time stamp before the handler call.
+ * @param  EndTime: Time stamp after the handler call.
+ * @return None.
+ */
+void IRQPROF_Record(uint32_t Index, uint32_t EntryTime, uint32_t StartTime, uint32_t EndTime)
+{
+    IRQPROF_Entry_TypeDef* Entry;
+
+    /* Check the parameters. */
+    assert_param(IS_IRQPROF_INDEX(Index));
+
+    Entry = &IRQPROF_Block.Entry[Index];
+    Entry->Count++;
+    IRQPROF_AddValue(StartTime - EntryTime, &Entry->LatencyMin, &Entry->LatencyMax, Entry->LatencyHist);
+    IRQPROF_AddValue(EndTime - StartTime, &Entry->DurationMin, &Entry->DurationMax, Entry->DurationHist);
+}
+
+/**
+ * @brief  Get the statistics of an interrupt.
+ * @param  Index: Statistics entry index, see IRQPROF_NUM_ENTRIES.
+ * @return Pointer to the statistics entry.
+ */
+const IRQPROF_Entry_TypeDef* IRQPROF_GetEntry(uint32_t Index)
+{
+    /* Check the parameters. */
+    assert_param(IS_IRQPROF_INDEX(Index));
+
+    return &IRQPROF_Block.Entry[Index];
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_IRQPROF_Exported_Functions */
+
+#endif /* IT_USE_PROFILE == 1 */
+
+/** @} */ /* End of the group MDR32VF0xI_System_IRQPROF */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_irqprof.c */
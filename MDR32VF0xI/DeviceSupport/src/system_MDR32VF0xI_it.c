@@ -21,6 +21,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "system_MDR32VF0xI_it.h"
+#include "system_MDR32VF0xI_irqprof.h"
 
 /** @addtogroup DEVICE_SUPPORT Device Support
  * @{
@@ -34,6 +35,58 @@
  * @{
  */
 
+#if (USE_IT_STACK == 1)
+/** @defgroup MDR32VF0xI_System_IT_Private_Variables MDR32VF0xI System IT Private Variables
+ * @{
+ */
+
+/**
+ * @brief Interrupt stack bounds defined by the linker script.
+ */
+extern uint32_t __irq_stack_top[];
+extern uint32_t __irq_stack_limit[];
+
+/** @} */ /* End of the group MDR32VF0xI_System_IT_Private_Variables */
+#endif
+
+#if defined(USE_MDR32F02) && (IT_PLIC_NESTED == 1)
+/** @defgroup MDR32VF0xI_System_IT_Private_Function_Prototypes MDR32VF0xI System IT Private Function Prototypes
+ * @{
+ */
+
+static void IT_DispatchNestedIRQ(void);
+
+/** @} */ /* End of the group MDR32VF0xI_System_IT_Private_Function_Prototypes */
+#endif
+
+/** @defgroup MDR32VF0xI_System_IT_Private_Functions MDR32VF0xI System IT Private Functions
+ * @{
+ */
+
+/**
+ * @brief  Call the interrupt handler: the registered handler with context
+ *         if IT_USE_HANDLER_TABLE is 1 and it is set, the vector table handler otherwise.
+ * @param  VectorTable: Vector table of the interrupt.
+ * @param  IRQn: Index of the interrupt in the vector table and the handler table.
+ * @return None.
+ */
+__STATIC_FORCEINLINE void IT_CallHandler(IRQHandler_TypeDef* VectorTable, uint32_t IRQn)
+{
+#if (IT_USE_HANDLER_TABLE == 1)
+    const IT_HandlerEntry_TypeDef* Entry = &IT_HandlerTable[IRQn];
+
+    if (Entry->Handler != NULL) {
+        Entry->Handler(Entry->Context);
+    } else {
+        (*VectorTable[IRQn])();
+    }
+#else
+    (*VectorTable[IRQn])();
+#endif
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_IT_Private_Functions */
+
 /** @addtogroup MDR32VF0xI_System_IT_Exported_Variables MDR32VF0xI System IT Exported Variables
  * @{
  */
@@ -162,6 +215,14 @@ IRQHandler_TypeDef ExtInterruptVectorTable[] = {
 };
 #endif
 
+#if (IT_USE_HANDLER_TABLE == 1)
+/**
+ * @brief IT handler table with contexts indexed by IRQn. The registered handler
+ *        gets the context of its entry, IC_ContextTable serves the vector table handlers.
+ */
+IT_HandlerEntry_TypeDef IT_HandlerTable[IT_NUM_HANDLERS];
+#endif
+
 /** @} */ /* End of the group MDR32VF0xI_System_IT_Exported_Variables */
 
 /** @addtogroup MDR32VF0xI_System_IT_Exported_Functions MDR32VF0xI System IT Exported Functions
@@ -275,59 +336,229 @@ FlagStatus IT_GetGlobalEnableIRQ(IT_PrivilegeModeIRQ_TypeDef PrivilegeMode)
 }
 #endif
 
-/** @} */ /* End of the group MDR32VF0xI_System_IT_Exported_Functions */
-
-/** @addtogroup MDR32VF0xI_System_IT_Exported_IRQ_Handlers MDR32VF0xI System IT Exported IRQ Handlers
- * @{
- */
-
 #if defined(USE_MDR32F02)
 /**
- * @brief  PLIC interrupt service routine.
- * @param  None.
+ * @brief  Dispatch a trap to the handler from the IT vector tables.
+ * @note   Called by Trap_IRQHandler and Trap_IRQEntry with the interrupts disabled.
+ *         If IT_USE_PROFILE is 1, every interrupt handler call is recorded by IRQPROF_Record.
+ * @param  MCause: MCAUSE value of the trap.
  * @return None.
  */
-__WEAK __INTERRUPT_MACHINE __TRAP_HANDLER_ALIGNED void Trap_IRQHandler(void)
+void IT_TrapDispatch(uint_xlen_t MCause)
 {
-    uint32_t ExtInterrupt, MCause;
+#if (IT_USE_PROFILE == 1)
+    uint32_t EntryTime = IRQPROF_GetTime();
+    uint32_t StartTime;
+#endif
+#if (IT_PLIC_NESTED == 0) && ((IT_USE_HANDLER_TABLE == 1) || (IT_USE_PROFILE == 1))
+    uint32_t SourceID;
+#endif
 
-    MCause = csr_read(CSR_MCAUSE);
     if (MCause & CSR_MCAUSE_INTERRUPT) {
         if (MCause == (CSR_MCAUSE_EXCCODE_MEI | CSR_MCAUSE_INTERRUPT)) {
-            ExtInterrupt = PLIC_ClaimIRQ();
-            while (ExtInterrupt) {
-                (*ExtInterruptVectorTable[ExtInterrupt])();
-                PLIC_CompleteIRQ(ExtInterrupt);
-                ExtInterrupt = PLIC_ClaimIRQ();
+#if (IT_PLIC_NESTED == 1)
+            IT_DispatchNestedIRQ();
+#elif (IT_USE_HANDLER_TABLE == 1) || (IT_USE_PROFILE == 1)
+            SourceID = PLIC_FastClaimIRQ();
+            while (SourceID != 0) {
+#if (IT_USE_PROFILE == 1)
+                StartTime = IRQPROF_GetTime();
+#endif
+                IT_CallHandler(ExtInterruptVectorTable, SourceID - 1);
+#if (IT_USE_PROFILE == 1)
+                IRQPROF_Record(IRQPROF_EXT_OFFSET + SourceID - 1, EntryTime, StartTime, IRQPROF_GetTime());
+#endif
+                PLIC_FastCompleteIRQ(SourceID);
+                SourceID = PLIC_FastClaimIRQ();
             }
+#else
+            PLIC_DispatchIRQ(ExtInterruptVectorTable);
+#endif
         } else {
+#if (IT_USE_PROFILE == 1)
+            StartTime = IRQPROF_GetTime();
+#endif
             (*InterruptVectorTable[MCause & CSR_MCAUSE_EXCCODE_Msk])();
+#if (IT_USE_PROFILE == 1)
+            IRQPROF_Record(MCause & CSR_MCAUSE_EXCCODE_Msk, EntryTime, StartTime, IRQPROF_GetTime());
+#endif
         }
     } else {
         (*ExceptionVectorTable[MCause])();
     }
 }
-
 #elif defined(USE_MDR1206)
 /**
- * @brief  CLIC interrupt service routine.
- * @note   If the interrupt is configured in vector mode, then its handler must be specified with __INTERRUPT_MACHINE or __INTERRUPT_USER.
- * @param  None.
+ * @brief  Dispatch a trap to the handler from the IT vector tables.
+ * @note   Called by Trap_IRQHandler and Trap_IRQEntry with the interrupts disabled.
+ *         If IT_USE_PROFILE is 1, every interrupt handler call is recorded by IRQPROF_Record.
+ * @param  MCause: MCAUSE value of the trap.
  * @return None.
  */
-__WEAK __INTERRUPT_MACHINE __TRAP_HANDLER_ALIGNED void Trap_IRQHandler(void)
+void IT_TrapDispatch(uint_xlen_t MCause)
 {
-    uint32_t MCause;
+#if (IT_USE_PROFILE == 1)
+    uint32_t EntryTime = IRQPROF_GetTime();
+    uint32_t StartTime;
+#endif
 
-    MCause = csr_read(CSR_MCAUSE);
     if (MCause & CSR_MCAUSE_INTERRUPT) {
-        (*InterruptVectorTable[MCause & CSR_MCAUSE_EXCCODE_Msk])();
+#if (IT_USE_PROFILE == 1)
+        StartTime = IRQPROF_GetTime();
+#endif
+        IT_CallHandler(InterruptVectorTable, MCause & CSR_MCAUSE_EXCCODE_Msk);
+#if (IT_USE_PROFILE == 1)
+        IRQPROF_Record(MCause & CSR_MCAUSE_EXCCODE_Msk, EntryTime, StartTime, IRQPROF_GetTime());
+#endif
     } else {
         (*ExceptionVectorTable[MCause & CSR_MCAUSE_EXCCODE_Msk])();
     }
 }
 #endif
 
+#if (IT_USE_HANDLER_TABLE == 1)
+/**
+ * @brief  Register an interrupt handler with context.
+ * @note   The registered handler takes precedence over the vector table handler.
+ *         On MDR1206 the interrupt is switched to the non-vectored mode,
+ *         since vectored interrupts do not pass through the trap dispatcher.
+ * @param  IRQn: Device specific interrupt number.
+ * @param  Handler: Interrupt handler, called with Context from the trap dispatcher.
+ * @param  Context: Handler context (for example, the driver instance).
+ * @return None.
+ */
+void IT_RegisterHandler(IRQn_TypeDef IRQn, IT_ContextHandler_TypeDef Handler, void* Context)
+{
+    uint_xlen_t MStatus;
+
+    /* Check the parameters. */
+    assert_param(IS_IRQ(IRQn));
+    assert_param(Handler != NULL);
+
+    MStatus = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    IT_HandlerTable[IRQn].Context = Context;
+    IT_HandlerTable[IRQn].Handler = Handler;
+#if defined(USE_MDR1206)
+    CLIC->INT[IRQn].ATTR &= (uint8_t)~CLIC_INTxATTR_SHV;
+#endif
+
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+}
+
+/**
+ * @brief  Unregister an interrupt handler with context, the vector table
+ *         handler is used again.
+ * @note   The entry is cleared with the interrupts disabled, so the trap
+ *         dispatcher never calls the handler with the cleared context.
+ * @param  IRQn: Device specific interrupt number.
+ * @return None.
+ */
+void IT_UnregisterHandler(IRQn_TypeDef IRQn)
+{
+    uint_xlen_t MStatus;
+
+    /* Check the parameters. */
+    assert_param(IS_IRQ(IRQn));
+
+    MStatus = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    IT_HandlerTable[IRQn].Handler = NULL;
+    IT_HandlerTable[IRQn].Context = NULL;
+
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+}
+#endif
+
+#if (USE_IT_STACK == 1)
+/**
+ * @brief  Initialize the interrupt stack: fill it with the canary pattern
+ *         and load its top address into MSCRATCH for Trap_IRQEntry.
+ * @note   Should be called before the interrupts are enabled.
+ *         __irq_stack_size should be set in the linker script, it is 0 by default.
+ * @param  None.
+ * @return None.
+ */
+__NO_INSTRUMENT void IT_InitStack(void)
+{
+    uint32_t* StackPtr;
+
+    /* Check the parameters. */
+    assert_param((uintptr_t)__irq_stack_limit < (uintptr_t)__irq_stack_top);
+
+    for (StackPtr = __irq_stack_limit; StackPtr < __irq_stack_top; StackPtr++) {
+        *StackPtr = IT_STACK_CANARY;
+    }
+
+    csr_write(CSR_MSCRATCH, (uint_xlen_t)__irq_stack_top);
+}
+
+/**
+ * @brief  Check the interrupt stack overflow canary.
+ * @param  None.
+ * @return @ref ErrorStatus - SUCCESS if the canary at the interrupt stack limit is intact,
+ *         ERROR otherwise or if no interrupt stack is reserved (__irq_stack_size is 0).
+ */
+ErrorStatus IT_CheckStack(void)
+{
+    ErrorStatus Status;
+
+    if (((uintptr_t)__irq_stack_limit < (uintptr_t)__irq_stack_top) && (*__irq_stack_limit == IT_STACK_CANARY)) {
+        Status = SUCCESS;
+    } else {
+        Status = ERROR;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief  Get the maximum interrupt stack usage since IT_InitStack.
+ * @param  None.
+ * @return Interrupt stack high-water mark in bytes.
+ */
+uint32_t IT_GetStackUsage(void)
+{
+    const uint32_t* StackPtr = __irq_stack_limit;
+
+    while ((StackPtr < __irq_stack_top) && (*StackPtr == IT_STACK_CANARY)) {
+        StackPtr++;
+    }
+
+    return (uint32_t)((uint8_t*)__irq_stack_top - (const uint8_t*)StackPtr);
+}
+#endif
+
+/** @} */ /* End of the group MDR32VF0xI_System_IT_Exported_Functions */
+
+/** @addtogroup MDR32VF0xI_System_IT_Exported_IRQ_Handlers MDR32VF0xI System IT Exported IRQ Handlers
+ * @{
+ */
+
+#if defined(USE_MDR32F02)
+/**
+ * @brief  PLIC interrupt service routine.
+ * @param  None.
+ * @return None.
+ */
+__WEAK __INTERRUPT_MACHINE __TRAP_HANDLER_ALIGNED void Trap_IRQHandler(void)
+{
+    IT_TrapDispatch(csr_read(CSR_MCAUSE));
+}
+
+#elif defined(USE_MDR1206)
+/**
+ * @brief  CLIC interrupt service routine.
+ * @note   If the interrupt is configured in vector mode, then its handler must be specified with __INTERRUPT_MACHINE or __INTERRUPT_USER.
+ * @param  None.
+ * @return None.
+ */
+__WEAK __INTERRUPT_MACHINE __TRAP_HANDLER_ALIGNED void Trap_IRQHandler(void)
+{
+    IT_TrapDispatch(csr_read(CSR_MCAUSE));
+}
+#endif
+
 /**
  * @brief  Stub of machine software interrupt handler.
  * @param  None.
@@ -790,6 +1021,62 @@ __WEAK void Unexpected_IRQHandler(void)
 
 /** @} */ /* End of the group MDR32VF0xI_System_IT_Exported_IRQ_Handlers */
 
+#if defined(USE_MDR32F02) && (IT_PLIC_NESTED == 1)
+/** @addtogroup MDR32VF0xI_System_IT_Private_Functions MDR32VF0xI System IT Private Functions
+ * @{
+ */
+
+/**
+ * @brief  Dispatch the pending external interrupts with preemption.
+ * @note   The PLIC threshold is raised to the priority of the claimed
+ *         interrupt and MIE is set while its handler runs, so only the
+ *         interrupts of higher priority can preempt it. MEPC, MCAUSE and
+ *         MSTATUS (MPIE, MPP) are saved for the nested traps.
+ * @param  None.
+ * @return None.
+ */
+static void IT_DispatchNestedIRQ(void)
+{
+    uint_xlen_t MEpc, MCause, MStatus;
+    uint32_t    SourceID, IRQn, PrevThreshold;
+#if (IT_USE_PROFILE == 1)
+    uint32_t EntryTime = IRQPROF_GetTime();
+    uint32_t StartTime;
+#endif
+
+    MEpc          = csr_read(CSR_MEPC);
+    MCause        = csr_read(CSR_MCAUSE);
+    MStatus       = csr_read(CSR_MSTATUS);
+    PrevThreshold = PLIC_READ_REG(PLIC_PTHR);
+
+    SourceID = PLIC_FastClaimIRQ();
+    while (SourceID != 0) {
+        IRQn = SourceID - 1;
+        PLIC_WRITE_REG(PLIC_PTHR, PLIC_READ_REG(PLIC_ISP(IRQn)));
+
+        csr_set_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+#if (IT_USE_PROFILE == 1)
+        StartTime = IRQPROF_GetTime();
+#endif
+        IT_CallHandler(ExtInterruptVectorTable, IRQn);
+#if (IT_USE_PROFILE == 1)
+        IRQPROF_Record(IRQPROF_EXT_OFFSET + IRQn, EntryTime, StartTime, IRQPROF_GetTime());
+#endif
+        csr_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+        PLIC_WRITE_REG(PLIC_PTHR, PrevThreshold);
+        PLIC_FastCompleteIRQ(SourceID);
+        SourceID = PLIC_FastClaimIRQ();
+    }
+
+    csr_write(CSR_MSTATUS, MStatus);
+    csr_write(CSR_MCAUSE, MCause);
+    csr_write(CSR_MEPC, MEpc);
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_IT_Private_Functions */
+#endif
+
 /** @} */ /* End of the group MDR32VF0xI_System_IT */
 
 /** @} */ /* End of the group MDR32VF0xI_DEVICE */
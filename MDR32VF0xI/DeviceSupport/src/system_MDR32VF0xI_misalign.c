@@ -0,0 +1,294 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_misalign.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the misaligned load and store emulation
+ *          (MISALIGN) firmware functions.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_misalign.h"
+#include "system_MDR32VF0xI_it.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_MISALIGN MDR32VF0xI System MISALIGN
+ * @{
+ */
+
+#if (IT_USE_MISALIGN_EMU == 1)
+
+/** @defgroup MDR32VF0xI_System_MISALIGN_Private_Defines MDR32VF0xI System MISALIGN Private Defines
+ * @{
+ */
+
+#define MISALIGN_OPCODE_LOAD  0x03U /*!< RV32I LOAD major opcode. */
+#define MISALIGN_OPCODE_STORE 0x23U /*!< RV32I STORE major opcode. */
+
+#define MISALIGN_REG_SP 2U /*!< Stack pointer register number. */
+
+/**
+ * @brief Extract the instruction bit field [HIGH:LOW].
+ */
+#define MISALIGN_BITS(INSTR, HIGH, LOW) (((INSTR) >> (LOW)) & ((1UL << ((HIGH) - (LOW) + 1)) - 1))
+
+/** @} */ /* End of the group MDR32VF0xI_System_MISALIGN_Private_Defines */
+
+/** @defgroup MDR32VF0xI_System_MISALIGN_Private_Variables MDR32VF0xI System MISALIGN Private Variables
+ * @{
+ */
+
+/**
+ * @brief Emulation statistics.
+ */
+static MISALIGN_Stats_TypeDef MISALIGN_Stats;
+
+/** @} */ /* End of the group MDR32VF0xI_System_MISALIGN_Private_Variables */
+
+/** @defgroup MDR32VF0xI_System_MISALIGN_Private_Functions MDR32VF0xI System MISALIGN Private Functions
+ * @{
+ */
+
+/**
+ * @brief  Count an emulated access of the faulting instruction.
+ * @param  PC: Address of the faulting instruction.
+ * @return None.
+ */
+static void MISALIGN_CountPC(uint_xlen_t PC)
+{
+    MISALIGN_PCEntry_TypeDef* Entry;
+    uint32_t                  Index;
+
+    for (Index = 0; Index < IT_MISALIGN_NUM_PCS; Index++) {
+        Entry = &MISALIGN_Stats.PC[Index];
+        if (Entry->Count == 0) {
+            Entry->PC    = PC;
+            Entry->Count = 1;
+            break;
+        }
+        if (Entry->PC == PC) {
+            Entry->Count++;
+            break;
+        }
+    }
+
+    if (Index == IT_MISALIGN_NUM_PCS) {
+        MISALIGN_Stats.Untracked++;
+    }
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_MISALIGN_Private_Functions */
+
+/** @addtogroup MDR32VF0xI_System_MISALIGN_Exported_Functions MDR32VF0xI System MISALIGN Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Decode an RV32IC load or store instruction.
+ * @note   Pure function, does not access the hardware.
+ * @param  Instr: Instruction, a compressed instruction in the lower 16 bits.
+ * @param  Decoded: Pointer to the @ref MISALIGN_Instr_TypeDef structure to fill.
+ * @return @ref ErrorStatus - SUCCESS if Instr is a supported load or store, ERROR otherwise.
+ */
+ErrorStatus MISALIGN_Decode(uint32_t Instr, MISALIGN_Instr_TypeDef* Decoded)
+{
+    ErrorStatus Status = SUCCESS;
+    uint32_t    Funct3;
+
+    if ((Instr & 0x3U) == 0x3U) {
+        /* 32-bit instruction. */
+        Funct3          = MISALIGN_BITS(Instr, 14, 12);
+        Decoded->Length = 4;
+        Decoded->BaseReg = (uint8_t)MISALIGN_BITS(Instr, 19, 15);
+
+        if ((Instr & 0x7FU) == MISALIGN_OPCODE_LOAD) {
+            /* LB 000, LH 001, LW 010, LBU 100, LHU 101. */
+            Decoded->Access     = MISALIGN_ACCESS_LOAD;
+            Decoded->Reg        = (uint8_t)MISALIGN_BITS(Instr, 11, 7);
+            Decoded->Offset     = (int32_t)Instr >> 20;
+            Decoded->Size       = (uint8_t)(1U << (Funct3 & 0x3U));
+            Decoded->SignExtend = (Funct3 & 0x4U) ? 0 : 1;
+            if ((Funct3 == 3) || (Funct3 > 5)) {
+                Status = ERROR;
+            }
+        } else if ((Instr & 0x7FU) == MISALIGN_OPCODE_STORE) {
+            /* SB 000, SH 001, SW 010. */
+            Decoded->Access     = MISALIGN_ACCESS_STORE;
+            Decoded->Reg        = (uint8_t)MISALIGN_BITS(Instr, 24, 20);
+            Decoded->Offset     = (((int32_t)Instr >> 25) << 5) | (int32_t)MISALIGN_BITS(Instr, 11, 7);
+            Decoded->Size       = (uint8_t)(1U << Funct3);
+            Decoded->SignExtend = 0;
+            if (Funct3 > 2) {
+                Status = ERROR;
+            }
+        } else {
+            Status = ERROR;
+        }
+    } else {
+        /* 16-bit compressed instruction. */
+        Funct3              = MISALIGN_BITS(Instr, 15, 13);
+        Decoded->Length     = 2;
+        Decoded->Size       = 4;
+
+        if (((Instr & 0x3U) == 0x0U) && ((Funct3 == 0x2U) || (Funct3 == 0x6U))) {
+            /* C.LW 010 / C.SW 110: rs1', rd'/rs2', uimm[5:3] = [12:10], uimm[2] = [6], uimm[6] = [5]. */
+            Decoded->Access     = (Funct3 == 0x2U) ? MISALIGN_ACCESS_LOAD : MISALIGN_ACCESS_STORE;
+            Decoded->SignExtend = (Funct3 == 0x2U) ? 1 : 0;
+            Decoded->Reg        = (uint8_t)(MISALIGN_BITS(Instr, 4, 2) + 8);
+            Decoded->BaseReg    = (uint8_t)(MISALIGN_BITS(Instr, 9, 7) + 8);
+            Decoded->Offset     = (int32_t)((MISALIGN_BITS(Instr, 12, 10) << 3) |
+                                           (MISALIGN_BITS(Instr, 6, 6) << 2) |
+                                           (MISALIGN_BITS(Instr, 5, 5) << 6));
+        } else if (((Instr & 0x3U) == 0x2U) && (Funct3 == 0x2U)) {
+            /* C.LWSP: rd = [11:7] (not x0), uimm[5] = [12], uimm[4:2] = [6:4], uimm[7:6] = [3:2]. */
+            Decoded->Access     = MISALIGN_ACCESS_LOAD;
+            Decoded->SignExtend = 1;
+            Decoded->Reg        = (uint8_t)MISALIGN_BITS(Instr, 11, 7);
+            Decoded->BaseReg    = MISALIGN_REG_SP;
+            Decoded->Offset     = (int32_t)((MISALIGN_BITS(Instr, 12, 12) << 5) |
+                                           (MISALIGN_BITS(Instr, 6, 4) << 2) |
+                                           (MISALIGN_BITS(Instr, 3, 2) << 6));
+            if (Decoded->Reg == 0) {
+                Status = ERROR;
+            }
+        } else if (((Instr & 0x3U) == 0x2U) && (Funct3 == 0x6U)) {
+            /* C.SWSP: rs2 = [6:2], uimm[5:2] = [12:9], uimm[7:6] = [8:7]. */
+            Decoded->Access     = MISALIGN_ACCESS_STORE;
+            Decoded->SignExtend = 0;
+            Decoded->Reg        = (uint8_t)MISALIGN_BITS(Instr, 6, 2);
+            Decoded->BaseReg    = MISALIGN_REG_SP;
+            Decoded->Offset     = (int32_t)((MISALIGN_BITS(Instr, 12, 9) << 2) |
+                                           (MISALIGN_BITS(Instr, 8, 7) << 6));
+        } else {
+            Status = ERROR;
+        }
+    }
+
+    return Status;
+}
+
+/**
+ * @brief  Emulate the misaligned load or store at MEPC, called by Trap_IRQEntry
+ *         for the load/store address misaligned exceptions.
+ * @note   The access is performed byte by byte, the loaded value is written to
+ *         Regs. The instructions that cannot be emulated (not a load or a store,
+ *         a load to sp) are passed to TrapLAM_IRQHandler or TrapSAM_IRQHandler.
+ * @param  Regs: Registers x0..x31 at the trap, written back by Trap_IRQEntry (except sp).
+ * @param  MEpc: Address of the faulting instruction.
+ * @param  MCause: MCAUSE of the exception.
+ * @return MEPC to return to: the next instruction if the access is emulated.
+ */
+uint_xlen_t MISALIGN_Emulate(uint_xlen_t* Regs, uint_xlen_t MEpc, uint_xlen_t MCause)
+{
+    MISALIGN_Instr_TypeDef Decoded;
+    MISALIGN_Access_TypeDef Access;
+    uint32_t               Instr, Value, Index;
+    uint8_t*               Address;
+
+    /* MEPC is 2-byte aligned with the compressed instructions. */
+    Instr = *(const uint16_t*)MEpc;
+    if ((Instr & 0x3U) == 0x3U) {
+        Instr |= (uint32_t)(*(const uint16_t*)(MEpc + 2)) << 16;
+    }
+
+    Access = ((MCause & 0xFU) == 4U) ? MISALIGN_ACCESS_LOAD : MISALIGN_ACCESS_STORE;
+
+    if ((MISALIGN_Decode(Instr, &Decoded) != SUCCESS) || (Decoded.Access != Access) ||
+        ((Decoded.Access == MISALIGN_ACCESS_LOAD) && (Decoded.Reg == MISALIGN_REG_SP))) {
+        MISALIGN_Stats.Unsupported++;
+        (*ExceptionVectorTable[MCause & 0xFU])();
+    } else {
+        Address = (uint8_t*)(Regs[Decoded.BaseReg] + (uint_xlen_t)Decoded.Offset);
+
+        if (Decoded.Access == MISALIGN_ACCESS_LOAD) {
+            Value = 0;
+            for (Index = Decoded.Size; Index > 0; Index--) {
+                Value = (Value << 8) | Address[Index - 1];
+            }
+            if ((Decoded.SignExtend != 0) && (Decoded.Size < 4)) {
+                Index = 32U - 8U * Decoded.Size;
+                Value = (uint32_t)((int32_t)(Value << Index) >> Index);
+            }
+            if (Decoded.Reg != 0) {
+                Regs[Decoded.Reg] = Value;
+            }
+            MISALIGN_Stats.Loads++;
+        } else {
+            Value = (uint32_t)Regs[Decoded.Reg];
+            for (Index = 0; Index < Decoded.Size; Index++) {
+                Address[Index] = (uint8_t)Value;
+                Value >>= 8;
+            }
+            MISALIGN_Stats.Stores++;
+        }
+
+        MISALIGN_CountPC(MEpc);
+        MEpc += Decoded.Length;
+    }
+
+    return MEpc;
+}
+
+/**
+ * @brief  Get the emulation statistics.
+ * @param  None.
+ * @return Pointer to the statistics.
+ */
+const MISALIGN_Stats_TypeDef* MISALIGN_GetStats(void)
+{
+    return &MISALIGN_Stats;
+}
+
+/**
+ * @brief  Reset the emulation statistics.
+ * @param  None.
+ * @return None.
+ */
+void MISALIGN_ResetStats(void)
+{
+    uint32_t Index;
+
+    MISALIGN_Stats.Loads       = 0;
+    MISALIGN_Stats.Stores      = 0;
+    MISALIGN_Stats.Unsupported = 0;
+    MISALIGN_Stats.Untracked   = 0;
+
+    for (Index = 0; Index < IT_MISALIGN_NUM_PCS; Index++) {
+        MISALIGN_Stats.PC[Index].PC    = 0;
+        MISALIGN_Stats.PC[Index].Count = 0;
+    }
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_MISALIGN_Exported_Functions */
+
+#endif /* IT_USE_MISALIGN_EMU == 1 */
+
+/** @} */ /* End of the group MDR32VF0xI_System_MISALIGN */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_misalign.c */
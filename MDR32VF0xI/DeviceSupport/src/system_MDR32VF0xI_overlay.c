@@ -0,0 +1,111 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_overlay.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the code overlay loader (OVERLAY)
+ *          firmware functions.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_overlay.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_OVERLAY MDR32VF0xI System OVERLAY
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_OVERLAY_Exported_Variables MDR32VF0xI System OVERLAY Exported Variables
+ * @{
+ */
+
+/**
+ * @brief OVERLAY number of the resident overlay.
+ */
+uint32_t OVERLAY_Resident = OVERLAY_NONE;
+
+/** @} */ /* End of the group MDR32VF0xI_System_OVERLAY_Exported_Variables */
+
+/** @defgroup MDR32VF0xI_System_OVERLAY_Private_Variables MDR32VF0xI System OVERLAY Private Variables
+ * @{
+ */
+
+/**
+ * @brief OVERLAY descriptors, defined by the linker script.
+ */
+extern const OVERLAY_Descriptor_TypeDef __overlay_table_start[OVERLAY_NUM];
+
+/** @} */ /* End of the group MDR32VF0xI_System_OVERLAY_Private_Variables */
+
+/** @addtogroup MDR32VF0xI_System_OVERLAY_Exported_Functions MDR32VF0xI System OVERLAY Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Copy an overlay from its load image into REGION_RAMFUNC and make it resident.
+ * @note   Overwrites the resident overlay, none of its functions should be active.
+ *         The load image is stored unpacked by Tools/image_compress.py, so it is
+ *         copied by words.
+ * @param  Overlay: Overlay number, less than OVERLAY_NUM.
+ * @return None.
+ */
+void OVERLAY_Load(uint32_t Overlay)
+{
+    const OVERLAY_Descriptor_TypeDef* Descriptor;
+    const uint32_t*                   Src;
+    uint32_t*                         Dst;
+    uint32_t*                         DstEnd;
+
+    /* Check the parameters. */
+    assert_param(IS_OVERLAY(Overlay));
+
+    Descriptor = &__overlay_table_start[Overlay];
+    Src        = (const uint32_t*)Descriptor->Load;
+    Dst        = (uint32_t*)Descriptor->Start;
+    DstEnd     = (uint32_t*)Descriptor->End;
+
+    /* No overlay is resident while it is overwritten. */
+    OVERLAY_Resident = OVERLAY_NONE;
+    __COMPILER_BARRIER();
+
+    while (Dst < DstEnd) {
+        *Dst++ = *Src++;
+    }
+
+    /* Instruction fetch sees the stores. */
+    __ASM volatile("fence.i" ::: "memory");
+
+    OVERLAY_Resident = Overlay;
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_OVERLAY_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_OVERLAY */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_overlay.c */
@@ -0,0 +1,221 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_pheap.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the intrusive pairing heap (PHEAP)
+ *          firmware functions.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_pheap.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_PHEAP MDR32VF0xI System PHEAP
+ * @{
+ */
+
+/** @defgroup MDR32VF0xI_System_PHEAP_Private_Functions MDR32VF0xI System PHEAP Private Functions
+ * @{
+ */
+
+/**
+ * @brief  Link two heap-ordered trees: the root with the larger key becomes
+ *         the first child of the other root.
+ * @param  First: Pointer to the root of the first tree.
+ * @param  Second: Pointer to the root of the second tree.
+ * @return Pointer to the root of the linked tree, its Next and Prev are NULL.
+ */
+static PHEAP_Node_TypeDef* PHEAP_Link(PHEAP_Node_TypeDef* First, PHEAP_Node_TypeDef* Second)
+{
+    PHEAP_Node_TypeDef* Node;
+
+    if (Second->Key < First->Key) {
+        Node   = First;
+        First  = Second;
+        Second = Node;
+    }
+
+    Second->Prev = First;
+    Second->Next = First->Child;
+    if (First->Child != NULL) {
+        First->Child->Prev = Second;
+    }
+    First->Child = Second;
+
+    First->Next = NULL;
+    First->Prev = NULL;
+
+    return First;
+}
+
+/**
+ * @brief  Merge a list of sibling trees into one tree (two-pass pairing).
+ * @param  First: Pointer to the first tree of the sibling list, can be NULL.
+ * @return Pointer to the root of the merged tree, NULL if the list is empty.
+ */
+static PHEAP_Node_TypeDef* PHEAP_MergePairs(PHEAP_Node_TypeDef* First)
+{
+    PHEAP_Node_TypeDef *Pairs = NULL, *Result = NULL, *Node, *Other;
+
+    /* Link the trees in pairs from left to right, keep the results in the reversed order. */
+    while (First != NULL) {
+        Node  = First;
+        Other = Node->Next;
+        if (Other != NULL) {
+            First = Other->Next;
+            Node  = PHEAP_Link(Node, Other);
+        } else {
+            First = NULL;
+        }
+        Node->Next = Pairs;
+        Pairs      = Node;
+    }
+
+    /* Link the results from right to left. */
+    while (Pairs != NULL) {
+        Node   = Pairs;
+        Pairs  = Node->Next;
+        Result = (Result == NULL) ? Node : PHEAP_Link(Result, Node);
+    }
+
+    if (Result != NULL) {
+        Result->Next = NULL;
+        Result->Prev = NULL;
+    }
+
+    return Result;
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_PHEAP_Private_Functions */
+
+/** @addtogroup MDR32VF0xI_System_PHEAP_Exported_Functions MDR32VF0xI System PHEAP Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize an empty heap.
+ * @param  Heap: Pointer to the heap.
+ * @return None.
+ */
+void PHEAP_Init(PHEAP_TypeDef* Heap)
+{
+    /* Check the parameters. */
+    assert_param(Heap != NULL);
+
+    Heap->Root = NULL;
+}
+
+/**
+ * @brief  Insert a node into the heap, O(1).
+ * @note   Node->Key should be set before the call.
+ *         The node should not be in a heap.
+ * @param  Heap: Pointer to the heap.
+ * @param  Node: Pointer to the node.
+ * @return None.
+ */
+void PHEAP_Insert(PHEAP_TypeDef* Heap, PHEAP_Node_TypeDef* Node)
+{
+    /* Check the parameters. */
+    assert_param(Heap != NULL);
+    assert_param(Node != NULL);
+
+    Node->Child = NULL;
+    Node->Next  = NULL;
+    Node->Prev  = NULL;
+
+    Heap->Root = (Heap->Root == NULL) ? Node : PHEAP_Link(Heap->Root, Node);
+}
+
+/**
+ * @brief  Remove a node from the heap.
+ * @note   The node is cut from its parent in O(1), its children are merged
+ *         back in O(log n) amortized, a node without children is removed in O(1).
+ * @param  Heap: Pointer to the heap.
+ * @param  Node: Pointer to the node, should be in the heap.
+ * @return None.
+ */
+void PHEAP_Remove(PHEAP_TypeDef* Heap, PHEAP_Node_TypeDef* Node)
+{
+    PHEAP_Node_TypeDef* Subtree;
+
+    /* Check the parameters. */
+    assert_param(Heap != NULL);
+    assert_param(Node != NULL);
+
+    if (Node == Heap->Root) {
+        Heap->Root = PHEAP_MergePairs(Node->Child);
+    } else {
+        /* Cut the subtree of the node. */
+        if (Node->Prev->Child == Node) {
+            Node->Prev->Child = Node->Next;
+        } else {
+            Node->Prev->Next = Node->Next;
+        }
+        if (Node->Next != NULL) {
+            Node->Next->Prev = Node->Prev;
+        }
+
+        /* Children keys are not less than the root key. */
+        Subtree = PHEAP_MergePairs(Node->Child);
+        if (Subtree != NULL) {
+            Heap->Root = PHEAP_Link(Heap->Root, Subtree);
+        }
+    }
+
+    Node->Child = NULL;
+    Node->Next  = NULL;
+    Node->Prev  = NULL;
+}
+
+/**
+ * @brief  Remove the node with the smallest key from the heap.
+ * @param  Heap: Pointer to the heap.
+ * @return Pointer to the removed node, NULL if the heap is empty.
+ */
+PHEAP_Node_TypeDef* PHEAP_PopMin(PHEAP_TypeDef* Heap)
+{
+    PHEAP_Node_TypeDef* Node;
+
+    /* Check the parameters. */
+    assert_param(Heap != NULL);
+
+    Node = Heap->Root;
+    if (Node != NULL) {
+        PHEAP_Remove(Heap, Node);
+    }
+
+    return Node;
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_PHEAP_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_PHEAP */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_pheap.c */
@@ -0,0 +1,381 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_swtimer.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the tickless software timers (SWTIMER)
+ *          firmware functions.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_swtimer.h"
+#include "system_MDR32VF0xI_clock.h"
+#include "system_MDR32VF0xI_it.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_SWTIMER MDR32VF0xI System SWTIMER
+ * @{
+ */
+
+/** @defgroup MDR32VF0xI_System_SWTIMER_Private_Variables MDR32VF0xI System SWTIMER Private Variables
+ * @{
+ */
+
+/**
+ * @brief Active timers ordered by the deadline.
+ */
+static PHEAP_TypeDef SWTIMER_Heap;
+
+/**
+ * @brief Machine timer compare value programmed last.
+ */
+static uint64_t SWTIMER_CompareTime = SWTIMER_NO_DEADLINE;
+
+/** @} */ /* End of the group MDR32VF0xI_System_SWTIMER_Private_Variables */
+
+/** @defgroup MDR32VF0xI_System_SWTIMER_Private_Functions MDR32VF0xI System SWTIMER Private Functions
+ * @{
+ */
+
+/**
+ * @brief  Program the machine timer compare value to the earliest deadline
+ *         if it has changed.
+ * @note   Should be called with the interrupts disabled.
+ * @param  None.
+ * @return None.
+ */
+static void SWTIMER_UpdateCompareTime(void)
+{
+    const PHEAP_Node_TypeDef* Root = PHEAP_GetMin(&SWTIMER_Heap);
+    uint64_t                  Deadline;
+
+    Deadline = (Root != NULL) ? Root->Key : SWTIMER_NO_DEADLINE;
+    if (Deadline != SWTIMER_CompareTime) {
+        SWTIMER_CompareTime = Deadline;
+        CLINT_MTIMER_SetCompareTime(Deadline);
+    }
+}
+
+/**
+ * @brief  Insert a timer into the deadline heap.
+ * @note   Should be called with the interrupts disabled.
+ * @param  Timer: Pointer to the timer, Timer->Node.Key is the deadline.
+ * @return None.
+ */
+__STATIC_INLINE void SWTIMER_Insert(SWTIMER_TypeDef* Timer)
+{
+    PHEAP_Insert(&SWTIMER_Heap, &Timer->Node);
+    Timer->Active = 1;
+}
+
+/**
+ * @brief  Remove a timer from the deadline heap if it is active.
+ * @note   Should be called with the interrupts disabled.
+ * @param  Timer: Pointer to the timer.
+ * @return None.
+ */
+__STATIC_INLINE void SWTIMER_Remove(SWTIMER_TypeDef* Timer)
+{
+    if (Timer->Active != 0) {
+        PHEAP_Remove(&SWTIMER_Heap, &Timer->Node);
+        Timer->Active = 0;
+    }
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_SWTIMER_Private_Functions */
+
+/** @addtogroup MDR32VF0xI_System_SWTIMER_Exported_Functions MDR32VF0xI System SWTIMER Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the software timers: clear the deadline heap, disarm
+ *         the machine timer compare and, if SWTIMER_USE_MTIP is 1, enable
+ *         the machine timer interrupt.
+ * @note   The machine timer is used only by SWTIMER after the call,
+ *         the other modules should use the software timers.
+ * @param  None.
+ * @return None.
+ */
+void SWTIMER_Init(void)
+{
+#if (SWTIMER_USE_MTIP == 1) && defined(USE_MDR1206)
+    CLIC_IRQ_InitTypeDef CLIC_IRQ_InitStruct;
+#endif
+
+    PHEAP_Init(&SWTIMER_Heap);
+    SWTIMER_CompareTime = SWTIMER_NO_DEADLINE;
+    CLINT_MTIMER_SetCompareTime(SWTIMER_NO_DEADLINE);
+
+#if (SWTIMER_USE_MTIP == 1)
+#if defined(USE_MDR1206)
+    CLIC_StructInitIRQ(&CLIC_IRQ_InitStruct);
+    CLIC_IRQ_InitStruct.CLIC_EnableIRQ    = ENABLE;
+    CLIC_IRQ_InitStruct.CLIC_VectoringIRQ = DISABLE;
+    CLIC_InitIRQ(MTIP_IRQn, &CLIC_IRQ_InitStruct);
+#elif defined(USE_MDR32F02)
+    PLIC_EnableMTIMERIRQ(PLIC_PRIVILEGE_IRQ_MODE_M);
+#endif
+#endif
+}
+
+/**
+ * @brief  Initialize a stopped timer.
+ * @param  Timer: Pointer to the timer.
+ * @param  Callback: Expiration callback.
+ * @param  Context: Callback context.
+ * @return None.
+ */
+void SWTIMER_Create(SWTIMER_TypeDef* Timer, SWTIMER_Callback_TypeDef Callback, void* Context)
+{
+    /* Check the parameters. */
+    assert_param(Timer != NULL);
+    assert_param(Callback != NULL);
+
+    Timer->Node.Key = 0;
+    Timer->Period   = 0;
+    Timer->Callback = Callback;
+    Timer->Context  = Context;
+    Timer->Active   = 0;
+}
+
+/**
+ * @brief  Start (or restart) a timer relative to the current machine time.
+ * @note   Can be called from any level, including the timer callbacks.
+ * @param  Timer: Pointer to the timer.
+ * @param  Delay: Time to the first expiration [MTIME ticks].
+ * @param  Period: Reload period [MTIME ticks], 0 for a one-shot timer.
+ * @return None.
+ */
+void SWTIMER_Start(SWTIMER_TypeDef* Timer, uint32_t Delay, uint32_t Period)
+{
+    SWTIMER_StartAt(Timer, CLOCK_GetTicks() + Delay, Period);
+}
+
+/**
+ * @brief  Start (or restart) a timer at an absolute machine time.
+ * @note   Can be called from any level, including the timer callbacks.
+ *         The machine timer compare is reprogrammed only if the earliest
+ *         deadline changes.
+ * @param  Timer: Pointer to the timer.
+ * @param  Deadline: Machine time of the first expiration (MTIME).
+ * @param  Period: Reload period [MTIME ticks], 0 for a one-shot timer.
+ * @return None.
+ */
+void SWTIMER_StartAt(SWTIMER_TypeDef* Timer, uint64_t Deadline, uint32_t Period)
+{
+    uint_xlen_t MStatus;
+
+    /* Check the parameters. */
+    assert_param(Timer != NULL);
+    assert_param(Deadline != SWTIMER_NO_DEADLINE);
+
+    MStatus = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    SWTIMER_Remove(Timer);
+    Timer->Node.Key = Deadline;
+    Timer->Period   = Period;
+    SWTIMER_Insert(Timer);
+    SWTIMER_UpdateCompareTime();
+
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+}
+
+/**
+ * @brief  Stop a timer, nothing is done if it is not active.
+ * @note   Can be called from any level, including the timer callbacks.
+ * @param  Timer: Pointer to the timer.
+ * @return None.
+ */
+void SWTIMER_Stop(SWTIMER_TypeDef* Timer)
+{
+    uint_xlen_t MStatus;
+
+    /* Check the parameters. */
+    assert_param(Timer != NULL);
+
+    MStatus = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    SWTIMER_Remove(Timer);
+    SWTIMER_UpdateCompareTime();
+
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+}
+
+/**
+ * @brief  Get the timer state.
+ * @param  Timer: Pointer to the timer.
+ * @return @ref FlagStatus - SET if the timer is active, RESET otherwise.
+ */
+FlagStatus SWTIMER_IsActive(const SWTIMER_TypeDef* Timer)
+{
+    /* Check the parameters. */
+    assert_param(Timer != NULL);
+
+    return (Timer->Active != 0) ? SET : RESET;
+}
+
+/**
+ * @brief  Get the earliest deadline of the active timers.
+ * @param  None.
+ * @return Machine time of the next expiration, SWTIMER_NO_DEADLINE if no timer is active.
+ */
+uint64_t SWTIMER_GetNextDeadline(void)
+{
+    uint_xlen_t MStatus;
+    uint64_t    Deadline;
+
+    MStatus  = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+    Deadline = SWTIMER_CompareTime;
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+
+    return Deadline;
+}
+
+/**
+ * @brief  Expire the timers whose deadlines have passed and program
+ *         the machine timer compare to the next deadline.
+ * @note   Called from the machine timer interrupt handler. The periodic timers
+ *         are reloaded before the callback (the callback may stop them);
+ *         the reload keeps the phase, a periodic timer late by more than
+ *         one period is reloaded from the current time.
+ *         The callbacks run with the interrupts disabled.
+ * @param  None.
+ * @return None.
+ */
+void SWTIMER_Process(void)
+{
+    SWTIMER_TypeDef* Timer;
+    uint_xlen_t      MStatus;
+    uint64_t         Now;
+
+    MStatus = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    Now = CLOCK_GetTicks();
+    while (1) {
+        Timer = (SWTIMER_TypeDef*)PHEAP_GetMin(&SWTIMER_Heap);
+        if ((Timer == NULL) || (Timer->Node.Key > Now)) {
+            break;
+        }
+
+        PHEAP_Remove(&SWTIMER_Heap, &Timer->Node);
+        Timer->Active = 0;
+        if (Timer->Period != 0) {
+            Timer->Node.Key += Timer->Period;
+            if (Timer->Node.Key <= Now) {
+                Timer->Node.Key = Now + Timer->Period;
+            }
+            SWTIMER_Insert(Timer);
+        }
+
+        Timer->Callback(Timer->Context);
+    }
+
+    SWTIMER_UpdateCompareTime();
+
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+}
+
+/**
+ * @brief  Convert the deadlines and the periods of the active timers
+ *         to a new machine timer frequency.
+ * @note   Called by FREQ_SetFrequency and FREQ_SetLSI after CLOCK_Init, so that
+ *         the timers keep their time to expiration. The time left from
+ *         the recalibration (CLOCK_Calib.BaseTicks) is converted, the passed
+ *         deadlines are kept. Other clock changes should call it too.
+ * @param  OldTickFreq: Machine timer frequency before the change [Hz].
+ * @param  NewTickFreq: Machine timer frequency after the change [Hz].
+ * @return None.
+ */
+void SWTIMER_Rescale(uint32_t OldTickFreq, uint32_t NewTickFreq)
+{
+    CLOCK_Conv_TypeDef  Conv;
+    PHEAP_Node_TypeDef* List = NULL;
+    PHEAP_Node_TypeDef* Node;
+    SWTIMER_TypeDef*    Timer;
+    uint_xlen_t         MStatus;
+    uint64_t            Base, Period;
+
+    if ((OldTickFreq == NewTickFreq) || (OldTickFreq == 0)) {
+        return;
+    }
+
+    CLOCK_InitConv(&Conv, OldTickFreq, NewTickFreq);
+
+    MStatus = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    Base = CLOCK_Calib.BaseTicks;
+
+    /* The conversion keeps the order, the timers are popped in a list and inserted back. */
+    while ((Node = PHEAP_PopMin(&SWTIMER_Heap)) != NULL) {
+        Node->Next = List;
+        List       = Node;
+    }
+    while (List != NULL) {
+        Node  = List;
+        List  = Node->Next;
+        Timer = (SWTIMER_TypeDef*)Node;
+        if (Node->Key > Base) {
+            Node->Key = Base + CLOCK_Convert(Node->Key - Base, &Conv);
+        }
+        if (Timer->Period != 0) {
+            Period        = CLOCK_Convert(Timer->Period, &Conv);
+            Timer->Period = (Period == 0) ? 1 : (Period > 0xFFFFFFFFUL) ? 0xFFFFFFFFUL : (uint32_t)Period;
+        }
+        PHEAP_Insert(&SWTIMER_Heap, Node);
+    }
+
+    SWTIMER_UpdateCompareTime();
+
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_SWTIMER_Exported_Functions */
+
+#if (SWTIMER_USE_MTIP == 1)
+/** @addtogroup MDR32VF0xI_System_SWTIMER_Exported_IRQ_Handlers MDR32VF0xI System SWTIMER Exported IRQ Handlers
+ * @{
+ */
+
+/**
+ * @brief  Machine timer interrupt handler: expires the software timers.
+ * @param  None.
+ * @return None.
+ */
+void MTIP_IRQHandler(void)
+{
+    SWTIMER_Process();
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_SWTIMER_Exported_IRQ_Handlers */
+#endif
+
+/** @} */ /* End of the group MDR32VF0xI_System_SWTIMER */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_swtimer.c */
@@ -0,0 +1,257 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_task.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the run-to-completion task (TASK) firmware functions.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_task.h"
+#include "system_MDR32VF0xI_it.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_TASK MDR32VF0xI System TASK
+ * @{
+ */
+
+#if defined(USE_MDR1206)
+
+/** @defgroup MDR32VF0xI_System_TASK_Private_Variables MDR32VF0xI System TASK Private Variables
+ * @{
+ */
+
+/**
+ * @brief Tasks indexed by the activating interrupt line.
+ */
+static TASK_TypeDef* TASK_Table[CLIC_NUM_INTERRUPTS];
+
+/**
+ * @brief Shift of the level in the CLIC level/priority byte (8 - CLIC NLBITS).
+ */
+static uint8_t TASK_LevelShift = 8;
+
+/** @} */ /* End of the group MDR32VF0xI_System_TASK_Private_Variables */
+
+/** @addtogroup MDR32VF0xI_System_TASK_Exported_Functions MDR32VF0xI System TASK Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the task scheduler.
+ * @note   Should be called after CLIC_Init (SystemInit) and before TASK_Create.
+ * @param  None.
+ * @return None.
+ */
+void TASK_Init(void)
+{
+    uint32_t IRQn;
+
+    for (IRQn = 0; IRQn < CLIC_NUM_INTERRUPTS; IRQn++) {
+        TASK_Table[IRQn] = NULL;
+    }
+
+    TASK_LevelShift = (uint8_t)(8 - ((CLIC->CFG & CLIC_CFG_NLBITS_Msk) >> CLIC_CFG_NLBITS_Pos));
+}
+
+/**
+ * @brief  Create a task bound to a CLIC interrupt line.
+ * @note   The interrupt line should not be used by a peripheral (CSIP_IRQn or
+ *         the line of an unused peripheral). It is configured as non-vectored,
+ *         edge-triggered, M-mode, at the task level, and its entry in the
+ *         InterruptVectorTable is replaced by TASK_IRQHandler.
+ *         Tasks of higher levels preempt the tasks of lower levels,
+ *         tasks of the same level run one after another.
+ * @param  Task: Pointer to the task control block.
+ * @param  IRQn: Activating interrupt line.
+ * @param  Level: Task level, from 1 to CLIC_MaxLevels - 1.
+ * @param  Handler: Event handler.
+ * @param  Queue: Event queue buffer of Size elements.
+ * @param  Size: Number of events in the queue buffer, should be a power of 2.
+ * @return None.
+ */
+void TASK_Create(TASK_TypeDef* Task, IRQn_TypeDef IRQn, uint8_t Level, TASK_Handler_TypeDef Handler,
+                 TASK_Event_TypeDef* Queue, uint32_t Size)
+{
+    CLIC_IRQ_InitTypeDef CLIC_IRQ_InitStruct;
+
+    /* Check the parameters. */
+    assert_param(IS_IRQ(IRQn));
+    assert_param(Level != 0);
+    assert_param(Handler != NULL);
+    assert_param(Queue != NULL);
+    assert_param(IS_TASK_QUEUE_SIZE(Size));
+
+    Task->IRQn      = IRQn;
+    Task->Level     = Level;
+    Task->Handler   = Handler;
+    Task->Queue     = Queue;
+    Task->Size      = Size;
+    Task->Head      = 0;
+    Task->Tail      = 0;
+    Task->Overflows = 0;
+
+    CLIC_DisableIRQ(IRQn);
+    CLIC_ClearPendingIRQ(IRQn);
+
+    TASK_Table[IRQn]           = Task;
+    InterruptVectorTable[IRQn] = TASK_IRQHandler;
+
+    CLIC_StructInitIRQ(&CLIC_IRQ_InitStruct);
+    CLIC_IRQ_InitStruct.CLIC_EnableIRQ    = ENABLE;
+    CLIC_IRQ_InitStruct.CLIC_VectoringIRQ = DISABLE;
+    CLIC_IRQ_InitStruct.CLIC_LevelIRQ     = Level;
+    CLIC_InitIRQ(IRQn, &CLIC_IRQ_InitStruct);
+}
+
+/**
+ * @brief  Post an event to a task and activate it.
+ * @note   Can be called from any level, including the interrupt handlers.
+ *         The task preempts the caller if its level is higher.
+ * @param  Task: Pointer to the task control block.
+ * @param  Signal: Event signal.
+ * @param  Param: Event parameter.
+ * @return @ref ErrorStatus - SUCCESS if the event is posted, ERROR if the queue is full.
+ */
+ErrorStatus TASK_Post(TASK_TypeDef* Task, uint32_t Signal, void* Param)
+{
+    uint_xlen_t         MStatus;
+    uint32_t            Head;
+    TASK_Event_TypeDef* Event;
+    ErrorStatus         Status;
+
+    /* Several levels may post to the same task. */
+    MStatus = csr_read_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    Head = Task->Head;
+    if ((Head - Task->Tail) >= Task->Size) {
+        Task->Overflows++;
+        Status = ERROR;
+    } else {
+        Event         = &Task->Queue[Head & (Task->Size - 1)];
+        Event->Signal = Signal;
+        Event->Param  = Param;
+        __COMPILER_BARRIER();
+        Task->Head = Head + 1;
+        Status     = SUCCESS;
+    }
+
+    csr_set_bits(CSR_MSTATUS, MStatus & CSR_MSTATUS_MIE);
+
+    if (Status == SUCCESS) {
+        CLIC->INT[Task->IRQn].IP = 1;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief  Lock a resource shared by tasks: raise the interrupt threshold
+ *         (MINTTHRESH) to the priority ceiling of the resource.
+ * @note   The ceiling is the highest level of the tasks using the resource.
+ *         Locks can be nested, each TASK_Lock should be paired with TASK_Unlock
+ *         at the same task level.
+ * @param  CeilingLevel: Priority ceiling level.
+ * @return Previous threshold to be passed to TASK_Unlock.
+ */
+uint8_t TASK_Lock(uint8_t CeilingLevel)
+{
+    uint8_t PrevThreshold, Threshold;
+
+    /* The lower level bits are implemented as ones, a threshold equal to the
+       full encoded ceiling level masks that level too. */
+    Threshold     = (uint8_t)((CeilingLevel << TASK_LevelShift) | ((1U << TASK_LevelShift) - 1));
+    PrevThreshold = (uint8_t)csr_read(CSR_MINTTHRESH);
+
+    if (Threshold > PrevThreshold) {
+        csr_write(CSR_MINTTHRESH, Threshold);
+    }
+
+    return PrevThreshold;
+}
+
+/**
+ * @brief  Unlock a resource locked by TASK_Lock.
+ * @param  PrevThreshold: Value returned by the paired TASK_Lock.
+ * @return None.
+ */
+void TASK_Unlock(uint8_t PrevThreshold)
+{
+    csr_write(CSR_MINTTHRESH, PrevThreshold);
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_TASK_Exported_Functions */
+
+/** @addtogroup MDR32VF0xI_System_TASK_Exported_IRQ_Handlers MDR32VF0xI System TASK Exported IRQ Handlers
+ * @{
+ */
+
+/**
+ * @brief  Task dispatcher, installed in the InterruptVectorTable by TASK_Create.
+ * @note   Saves MEPC and MCAUSE (with MPIL and MPIE), re-enables the interrupts
+ *         so that higher levels can preempt, and runs the task handler
+ *         until the event queue is empty.
+ * @param  None.
+ * @return None.
+ */
+void TASK_IRQHandler(void)
+{
+    uint_xlen_t         MCause, MEpc;
+    TASK_TypeDef*       Task;
+    TASK_Event_TypeDef* Event;
+    uint32_t            Tail;
+
+    MCause = csr_read(CSR_MCAUSE);
+    MEpc   = csr_read(CSR_MEPC);
+    Task   = TASK_Table[MCause & CSR_MCAUSE_EXCCODE_Msk];
+
+    CLIC->INT[Task->IRQn].IP = 0;
+    csr_set_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+
+    Tail = Task->Tail;
+    while (Tail != Task->Head) {
+        __COMPILER_BARRIER();
+        Event = &Task->Queue[Tail & (Task->Size - 1)];
+        Task->Handler(Event);
+        Tail++;
+        Task->Tail = Tail;
+    }
+
+    csr_clear_bits(CSR_MSTATUS, CSR_MSTATUS_MIE);
+    csr_write(CSR_MCAUSE, MCause);
+    csr_write(CSR_MEPC, MEpc);
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_TASK_Exported_IRQ_Handlers */
+
+#endif /* USE_MDR1206 */
+
+/** @} */ /* End of the group MDR32VF0xI_System_TASK */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_task.c */
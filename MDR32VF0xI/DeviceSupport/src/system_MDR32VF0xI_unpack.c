@@ -0,0 +1,105 @@
+/**
+ *******************************************************************************
+ * @file    system_MDR32VF0xI_unpack.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   This file contains all the startup section decompression (UNPACK)
+ *          firmware functions.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "system_MDR32VF0xI_unpack.h"
+
+/** @addtogroup DEVICE_SUPPORT Device Support
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_DEVICE MDR32VF0xI
+ *  @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_UNPACK MDR32VF0xI System UNPACK
+ * @{
+ */
+
+/** @addtogroup MDR32VF0xI_System_UNPACK_Exported_Functions MDR32VF0xI System UNPACK Exported Functions
+ * @{
+ */
+
+/**
+ * @brief  Expand an LZ4 block (Tools/image_compress.py) into RAM.
+ * @note   Called by the startup file before .data and .bss are initialized,
+ *         so it is placed in .text.init and uses no global data. The block ends
+ *         with the literals of its last sequence reaching DstEnd.
+ *         The function does not depend on the target and can be built on
+ *         the host to check the packer output.
+ * @param  Src: Pointer to the LZ4 block.
+ * @param  Dst: Pointer to the section start.
+ * @param  DstEnd: Pointer to the section end.
+ * @return Pointer to the end of the LZ4 block.
+ */
+__STARTUPFUNC const uint8_t* UNPACK_LZ4(const uint8_t* Src, uint8_t* Dst, const uint8_t* DstEnd)
+{
+    const uint8_t* Match;
+    uint32_t       Token, Length, Byte;
+
+    while (1) {
+        Token = *Src++;
+
+        /* Literals. */
+        Length = Token >> 4;
+        if (Length == 15) {
+            do {
+                Byte = *Src++;
+                Length += Byte;
+            } while (Byte == 255);
+        }
+        for (; Length != 0; Length--) {
+            *Dst++ = *Src++;
+        }
+        if (Dst >= DstEnd) {
+            break;
+        }
+
+        /* Match: 16-bit little-endian offset back from Dst. */
+        Match = Dst - ((uint32_t)Src[0] | ((uint32_t)Src[1] << 8));
+        Src += 2;
+        Length = (Token & 0xFU) + 4;
+        if ((Token & 0xFU) == 15) {
+            do {
+                Byte = *Src++;
+                Length += Byte;
+            } while (Byte == 255);
+        }
+        for (; Length != 0; Length--) {
+            *Dst++ = *Match++;
+        }
+    }
+
+    return Src;
+}
+
+/** @} */ /* End of the group MDR32VF0xI_System_UNPACK_Exported_Functions */
+
+/** @} */ /* End of the group MDR32VF0xI_System_UNPACK */
+
+/** @} */ /* End of the group MDR32VF0xI_DEVICE */
+
+/** @} */ /* End of the group DEVICE_SUPPORT */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE system_MDR32VF0xI_unpack.c */
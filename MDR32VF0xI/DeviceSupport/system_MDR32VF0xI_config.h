@@ -126,6 +126,364 @@ void assert_failed(uint8_t* file, uint32_t line, const uint8_t* expr);
 
 #endif
 
+/* Interrupt subsystem configuration. */
+/** Specify if traps are handled on a dedicated interrupt stack:
+    0: traps run on the stack of the interrupted code, Trap_IRQHandler is used as the trap vector;
+    1: Trap_IRQEntry (startup file) switches to the interrupt stack (__irq_stack_top, __irq_stack_size
+       in the linker script) through MSCRATCHCSWL (MDR1206) or MSCRATCH (MDR32F02).
+       __irq_stack_size is 0 in the linker scripts, so that the heap is not reduced,
+       and should be raised together with this switch (for example, to 0x400).
+    Default: 0 (interrupt stack is not used). */
+#ifndef USE_IT_STACK
+#define USE_IT_STACK 0
+#endif
+
+#if (USE_IT_STACK != 0) && (USE_IT_STACK != 1)
+#error "USE_IT_STACK should be 0 (interrupt stack is not used) or 1 (interrupt stack is used)."
+#endif
+
+/* Deferred work configuration. */
+/** Specify how the deferred work queues are drained:
+    0: DEFER_Process is called by the application (for example, from the main loop);
+    1: DEFER_Post requests the software interrupt (CSIP for MDR1206, MSIP for MDR32F02),
+       its handler calls DEFER_Process with the interrupts enabled.
+    Default: 0 (queues are drained by the application). */
+#ifndef DEFER_USE_SWI
+#define DEFER_USE_SWI 0
+#endif
+
+/** CLIC level of the deferred work software interrupt (MDR1206 and DEFER_USE_SWI is 1).
+    Should be lower than the levels of the interrupts posting the work.
+    Default: 1 (lowest level above the thread level). */
+#ifndef DEFER_SWI_LEVEL
+#define DEFER_SWI_LEVEL 1
+#endif
+
+#if (DEFER_USE_SWI != 0) && (DEFER_USE_SWI != 1)
+#error "DEFER_USE_SWI should be 0 (drained by the application) or 1 (drained by the software interrupt)."
+#endif
+
+/** Specify if the external interrupts can preempt each other (MDR32F02):
+    0: external interrupt handlers run with the interrupts disabled;
+    1: the PLIC threshold is raised to the priority of the claimed interrupt
+       and the interrupts are enabled while its handler runs.
+    Default: 0 (external interrupts are not nested). */
+#ifndef IT_PLIC_NESTED
+#define IT_PLIC_NESTED 0
+#endif
+
+#if (IT_PLIC_NESTED != 0) && (IT_PLIC_NESTED != 1)
+#error "IT_PLIC_NESTED should be 0 (not nested) or 1 (nested)."
+#endif
+
+/** Specify if the interrupt handlers with context can be registered at run time:
+    0: interrupts are dispatched only through the vector tables;
+    1: IT_RegisterHandler installs a handler and context pair into IT_HandlerTable
+       (RAM TCM, REGION_DATA), the trap dispatcher calls it with the context.
+    Default: 0 (handlers with context are not used). */
+#ifndef IT_USE_HANDLER_TABLE
+#define IT_USE_HANDLER_TABLE 0
+#endif
+
+#if (IT_USE_HANDLER_TABLE != 0) && (IT_USE_HANDLER_TABLE != 1)
+#error "IT_USE_HANDLER_TABLE should be 0 (not used) or 1 (used)."
+#endif
+
+/** Specify if the interrupt handlers are profiled (IRQPROF):
+    0: the trap dispatcher is not instrumented;
+    1: the trap dispatcher time stamps every interrupt handler and accumulates
+       the per-interrupt latency and duration statistics in IRQPROF_Block
+       (RAM TCM, .noinit section).
+    Default: 0 (interrupt handlers are not profiled). */
+#ifndef IT_USE_PROFILE
+#define IT_USE_PROFILE 0
+#endif
+
+/** Specify the IRQPROF time stamp source (IT_USE_PROFILE is 1):
+    0: MCYCLE CSR (core clock cycles);
+    1: MTIME register of CLINT (for the cores or configurations without MCYCLE).
+    Default: 0 (MCYCLE). */
+#ifndef IT_PROFILE_CLOCK
+#define IT_PROFILE_CLOCK 0
+#endif
+
+#if (IT_USE_PROFILE != 0) && (IT_USE_PROFILE != 1)
+#error "IT_USE_PROFILE should be 0 (not profiled) or 1 (profiled)."
+#endif
+
+#if (IT_PROFILE_CLOCK != 0) && (IT_PROFILE_CLOCK != 1)
+#error "IT_PROFILE_CLOCK should be 0 (MCYCLE) or 1 (MTIME)."
+#endif
+
+/** Specify how Trap_IRQEntry (startup file) dispatches the traps:
+    0: Trap_IRQEntry is used only if USE_IT_STACK is 1 and calls IT_TrapDispatch;
+    1: Trap_IRQEntry is always installed as the trap vector and calls the handlers
+       from ExceptionVectorTable, InterruptVectorTable and ExtInterruptVectorTable
+       (MDR32F02, PLIC claim/complete loop) directly, without a C dispatcher frame.
+       Requires IT_PLIC_NESTED, IT_USE_HANDLER_TABLE and IT_USE_PROFILE to be 0.
+    Default: 0 (traps are dispatched by IT_TrapDispatch). */
+#ifndef IT_USE_FAST_TRAP
+#define IT_USE_FAST_TRAP 0
+#endif
+
+#if (IT_USE_FAST_TRAP != 0) && (IT_USE_FAST_TRAP != 1)
+#error "IT_USE_FAST_TRAP should be 0 (C dispatcher) or 1 (assembly dispatcher)."
+#endif
+
+#if (IT_USE_FAST_TRAP == 1) && ((IT_PLIC_NESTED == 1) || (IT_USE_HANDLER_TABLE == 1) || (IT_USE_PROFILE == 1))
+#error "IT_USE_FAST_TRAP can not be used with IT_PLIC_NESTED, IT_USE_HANDLER_TABLE or IT_USE_PROFILE."
+#endif
+
+/** Specify if the misaligned loads and stores are emulated (MISALIGN):
+    0: the load/store address misaligned exceptions go to TrapLAM_IRQHandler and TrapSAM_IRQHandler;
+    1: Trap_IRQEntry is installed as the trap vector and passes these exceptions
+       to MISALIGN_Emulate, which performs the access byte by byte and resumes
+       after the faulting instruction (RV32IC loads and stores).
+    Default: 0 (misaligned accesses are not emulated). */
+#ifndef IT_USE_MISALIGN_EMU
+#define IT_USE_MISALIGN_EMU 0
+#endif
+
+/** Number of the faulting instruction addresses counted by MISALIGN (IT_USE_MISALIGN_EMU is 1).
+    Default: 8. */
+#ifndef IT_MISALIGN_NUM_PCS
+#define IT_MISALIGN_NUM_PCS 8
+#endif
+
+#if (IT_USE_MISALIGN_EMU != 0) && (IT_USE_MISALIGN_EMU != 1)
+#error "IT_USE_MISALIGN_EMU should be 0 (not emulated) or 1 (emulated)."
+#endif
+
+/** Specify how the software timers (SWTIMER) are serviced:
+    0: the application calls SWTIMER_Process from its MTIP_IRQHandler;
+    1: SWTIMER_Init enables the machine timer interrupt and SWTIMER provides
+       MTIP_IRQHandler, which calls SWTIMER_Process.
+    Default: 0 (serviced by the application). */
+#ifndef SWTIMER_USE_MTIP
+#define SWTIMER_USE_MTIP 0
+#endif
+
+#if (SWTIMER_USE_MTIP != 0) && (SWTIMER_USE_MTIP != 1)
+#error "SWTIMER_USE_MTIP should be 0 (serviced by the application) or 1 (serviced by MTIP_IRQHandler)."
+#endif
+
+/** Specify how CLOCK_GetTicks reads the machine timer:
+    0: MTIME is read through the CLINT memory-mapped registers;
+    1: MTIME is read with the TIME and TIMEH CSRs (rdtime, rdtimeh),
+       should be used only if the core implements them.
+    Default: 0 (memory-mapped MTIME). */
+#ifndef CLOCK_USE_TIME_CSR
+#define CLOCK_USE_TIME_CSR 0
+#endif
+
+#if (CLOCK_USE_TIME_CSR != 0) && (CLOCK_USE_TIME_CSR != 1)
+#error "CLOCK_USE_TIME_CSR should be 0 (memory-mapped MTIME) or 1 (TIME CSRs)."
+#endif
+
+/** Specify if SystemCoreClockUpdate recalibrates CLOCK:
+    0: SystemCoreClockUpdate only updates SystemCoreClock, the application
+       calls CLOCK_Init after SystemInit and after its own clock changes
+       (FREQ and HSICAL call it themselves);
+    1: SystemCoreClockUpdate calls CLOCK_Init, so the CLOCK conversions and DELAY
+       follow every core clock update, system_MDR32VF0xI_clock.c should be built.
+    Default: 0 (the baseline system files link without CLOCK). */
+#ifndef CLOCK_USE_CORE_CLOCK_UPDATE
+#define CLOCK_USE_CORE_CLOCK_UPDATE 0
+#endif
+
+#if (CLOCK_USE_CORE_CLOCK_UPDATE != 0) && (CLOCK_USE_CORE_CLOCK_UPDATE != 1)
+#error "CLOCK_USE_CORE_CLOCK_UPDATE should be 0 (CLOCK_Init called by the application) or 1 (called by SystemCoreClockUpdate)."
+#endif
+
+/** Specify the clock generator used by SystemClockConfig:
+    0: HSI;
+    1: HSE, SystemClockConfig falls back to HSI if HSE is not ready in time.
+    Default: 1 (HSE). */
+#ifndef CLKCFG_USE_HSE
+#define CLKCFG_USE_HSE 1
+#endif
+
+#if (CLKCFG_USE_HSE != 0) && (CLKCFG_USE_HSE != 1)
+#error "CLKCFG_USE_HSE should be 0 (HSI) or 1 (HSE)."
+#endif
+
+/** Maximum CPU_C2 (PLL output) and HCLK frequency allowed for the clock configuration solver [Hz].
+    Default: 60000000 (60MHz). */
+#ifndef CLKCFG_MAX_FREQUENCY_Hz
+#define CLKCFG_MAX_FREQUENCY_Hz 60000000
+#endif
+
+/** Maximum HCLK frequency for the FLASH read without the wait state (FLASH_CMD_DELAY_CYCLE_0) [Hz].
+    Default: 30000000 (30MHz). */
+#ifndef CLKCFG_FLASH_DELAY_0_MAX_Hz
+#define CLKCFG_FLASH_DELAY_0_MAX_Hz 30000000
+#endif
+
+#if (CLKCFG_FLASH_DELAY_0_MAX_Hz > CLKCFG_MAX_FREQUENCY_Hz)
+#error "CLKCFG_FLASH_DELAY_0_MAX_Hz should not exceed CLKCFG_MAX_FREQUENCY_Hz."
+#endif
+
+/** Specify if the clock tree is static (see system_MDR32VF0xI_clktree.h):
+    0: SystemCoreClock is a variable updated by SystemCoreClockUpdate;
+    1: the clock tree is described by the CLKTREE_* parameters below and
+       evaluated at compile time, SystemCoreClock is a constant and
+       SystemInit programs the clock tree.
+    Default: 0 (dynamic clock tree). */
+#ifndef CLKTREE_STATIC
+#define CLKTREE_STATIC 0
+#endif
+
+#if (CLKTREE_STATIC != 0) && (CLKTREE_STATIC != 1)
+#error "CLKTREE_STATIC should be 0 (dynamic clock tree) or 1 (static clock tree)."
+#endif
+
+/** Static clock tree generator:
+    0: HSI;
+    1: HSE.
+    Default: 1 (HSE). */
+#ifndef CLKTREE_USE_HSE
+#define CLKTREE_USE_HSE 1
+#endif
+
+/** Static clock tree CPU_C1 divider of the generator: 1 or 2.
+    Default: 1. */
+#ifndef CLKTREE_CPU_C1_DIV
+#define CLKTREE_CPU_C1_DIV 1
+#endif
+
+/** Static clock tree CPU PLL multiplier: 2..16, 0 if the PLL is not used.
+    Default: 7 (56MHz from 8MHz HSE). */
+#ifndef CLKTREE_PLL_MUL
+#define CLKTREE_PLL_MUL 7
+#endif
+
+/** Static clock tree CPU_C3 divider: 1, 2, 4, ..., 256.
+    Default: 1. */
+#ifndef CLKTREE_CPU_C3_DIV
+#define CLKTREE_CPU_C3_DIV 1
+#endif
+
+/** Static clock tree machine timer prescaler (DIV_SYS_TIM): 0..255, MTIME is clocked by HCLK / (CLKTREE_DIV_SYS_TIM + 1).
+    Default: 0. */
+#ifndef CLKTREE_DIV_SYS_TIM
+#define CLKTREE_DIV_SYS_TIM 0
+#endif
+
+#if (CLKTREE_STATIC == 1)
+#if (CLKTREE_USE_HSE != 0) && (CLKTREE_USE_HSE != 1)
+#error "CLKTREE_USE_HSE should be 0 (HSI) or 1 (HSE)."
+#endif
+
+#if (CLKTREE_CPU_C1_DIV != 1) && (CLKTREE_CPU_C1_DIV != 2)
+#error "CLKTREE_CPU_C1_DIV should be 1 or 2."
+#endif
+
+#if (CLKTREE_PLL_MUL != 0) && ((CLKTREE_PLL_MUL < 2) || (CLKTREE_PLL_MUL > 16))
+#error "CLKTREE_PLL_MUL should be 0 (PLL is not used) or 2..16."
+#endif
+
+#if (CLKTREE_CPU_C3_DIV < 1) || (CLKTREE_CPU_C3_DIV > 256) || ((CLKTREE_CPU_C3_DIV & (CLKTREE_CPU_C3_DIV - 1)) != 0)
+#error "CLKTREE_CPU_C3_DIV should be 1, 2, 4, ..., 256."
+#endif
+
+#if (CLKTREE_DIV_SYS_TIM < 0) || (CLKTREE_DIV_SYS_TIM > 255)
+#error "CLKTREE_DIV_SYS_TIM should be 0..255."
+#endif
+#endif
+
+/** Specify if the boot phase profiler (BOOTPROF) records MCYCLE at the phase
+    boundaries of the startup file and SystemInit (section copy, section zeroing,
+    DMA wait, __libc_init_array, SystemInit steps) into BOOTPROF_Record
+    (.noinit, kept over a warm reset, see Tools/bootprof_decode.py):
+    0: disabled;
+    1: enabled.
+    Default: 0 (disabled). */
+#ifndef STARTUP_MEASURE_CYCLES
+#define STARTUP_MEASURE_CYCLES 0
+#endif
+
+#if (STARTUP_MEASURE_CYCLES != 0) && (STARTUP_MEASURE_CYCLES != 1)
+#error "STARTUP_MEASURE_CYCLES should be 0 (disabled) or 1 (enabled)."
+#endif
+
+/** Specify if the startup file copies the large __copy_table sections by DMA:
+    0: the sections are copied by the CPU;
+    1: the sections of STARTUP_DMA_MIN_SIZE bytes and more are split into DMA
+       memory-to-memory transfers of up to 1024 words (one channel each),
+       the CPU copies the other sections and zeroes .bss meanwhile and waits
+       for the DMA before __libc_init_array. The DMA control data is placed in
+       .ahbram_noinit, the DMA is returned to its reset state after the copy.
+    Default: 0 (copied by the CPU). */
+#ifndef STARTUP_USE_DMA
+#define STARTUP_USE_DMA 0
+#endif
+
+/** Minimum size of a section copied by DMA [bytes], a multiple of 4.
+    Default: 1024. */
+#ifndef STARTUP_DMA_MIN_SIZE
+#define STARTUP_DMA_MIN_SIZE 1024
+#endif
+
+#if (STARTUP_USE_DMA != 0) && (STARTUP_USE_DMA != 1)
+#error "STARTUP_USE_DMA should be 0 (copied by the CPU) or 1 (copied by DMA)."
+#endif
+
+#if (STARTUP_DMA_MIN_SIZE < 4) || ((STARTUP_DMA_MIN_SIZE % 4) != 0)
+#error "STARTUP_DMA_MIN_SIZE should be a multiple of 4."
+#endif
+
+/** Specify if the startup file unpacks the compressed __copy_table sections
+    (see Tools/image_compress.py):
+    0: the sections are copied as they are;
+    1: the sections marked by the post-link packer (bit 0 of the load address)
+       are expanded by UNPACK_LZ4 (system_MDR32VF0xI_unpack.c, .text.init),
+       the other sections are copied.
+    Default: 0 (copied as they are). */
+#ifndef STARTUP_USE_UNPACK
+#define STARTUP_USE_UNPACK 0
+#endif
+
+#if (STARTUP_USE_UNPACK != 0) && (STARTUP_USE_UNPACK != 1)
+#error "STARTUP_USE_UNPACK should be 0 (copied as they are) or 1 (unpacked)."
+#endif
+
+/** Specify if the function profiler (FUNCPROF) records the calls of the code
+    built with -finstrument-functions (see Tools/ramfunc_place.py):
+    0: disabled;
+    1: the __cyg_profile_func_enter/exit hooks count the calls and the self
+       MCYCLE cycles of every function into FUNCPROF_Block (.noinit) between
+       FUNCPROF_Init and FUNCPROF_Stop of the current boot. The startup code and
+       SystemInit are not instrumented.
+    Default: 0 (disabled). */
+#ifndef USE_FUNCPROF
+#define USE_FUNCPROF 0
+#endif
+
+/** Number of the functions FUNCPROF_Block holds, a power of 2.
+    Default: 256. */
+#ifndef FUNCPROF_NUM_ENTRIES
+#define FUNCPROF_NUM_ENTRIES 256
+#endif
+
+/** Call depth tracked by FUNCPROF, the calls nested deeper are counted
+    without the cycles.
+    Default: 32. */
+#ifndef FUNCPROF_STACK_DEPTH
+#define FUNCPROF_STACK_DEPTH 32
+#endif
+
+#if (USE_FUNCPROF != 0) && (USE_FUNCPROF != 1)
+#error "USE_FUNCPROF should be 0 (disabled) or 1 (enabled)."
+#endif
+
+#if (FUNCPROF_NUM_ENTRIES < 2) || (FUNCPROF_NUM_ENTRIES > 32768) || ((FUNCPROF_NUM_ENTRIES & (FUNCPROF_NUM_ENTRIES - 1)) != 0)
+#error "FUNCPROF_NUM_ENTRIES should be a power of 2 from 2 to 32768."
+#endif
+
+#if (FUNCPROF_STACK_DEPTH < 1) || (FUNCPROF_STACK_DEPTH > 255)
+#error "FUNCPROF_STACK_DEPTH should be from 1 to 255."
+#endif
+
 #ifndef __ASSEMBLER__
 
 
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+"""
+Decoder of the boot phase profiler (BOOTPROF) records.
+
+The records (BOOTPROF_Record and BOOTPROF_PrevRecord, system_MDR32VF0xI_bootprof.h)
+are kept in the .noinit section, so they can be read from a memory dump taken
+by a debugger after a stop or a warm reset, for example (OpenOCD):
+
+    dump_image bootprof.bin <address of BOOTPROF_Record> <2 * sizeof(BOOTPROF_Record)>
+
+Usage:
+
+    bootprof_decode.py DUMP [--offset OFFSET] [--csv FILE] [--baseline FILE]
+
+DUMP is a raw binary memory dump. If OFFSET is not given, the dump is searched
+for the record magic at the word aligned offsets and all the records found are
+printed. --csv writes the phases of the first record (the phase name, cycles
+and microseconds per line), --baseline compares the first record with such
+a file from an earlier release.
+
+Copyright (C) {YYYY} Milandr
+"""
+
+import argparse
+import csv
+import struct
+import sys
+
+BOOTPROF_MAGIC = 0x46525042
+BOOTPROF_VERSION = 1
+
+HEADER_FORMAT = "<IHBBI"
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+MARK_FORMAT = "<IIB3x"
+MARK_SIZE = struct.calcsize(MARK_FORMAT)
+
+BOOTPROF_ID_USER = 16
+
+# Phase ended by each mark
+PHASE_NAMES = {
+    0: "Reset, boot ROM",
+    1: "Section copy",
+    2: "Section zeroing",
+    3: "DMA copy wait",
+    4: "__libc_init_array",
+    5: "SystemInit: interrupts",
+    6: "SystemInit: clock",
+    7: "SystemInit: rest",
+}
+
+
+def phase_name(mark_id):
+    """Name of the phase ended by a mark."""
+    if mark_id >= BOOTPROF_ID_USER:
+        return "main: USER+%d" % (mark_id - BOOTPROF_ID_USER)
+    return PHASE_NAMES.get(mark_id, "ID%d" % mark_id)
+
+
+def find_records(data):
+    """Offsets of the record magic in the dump."""
+    magic = struct.pack("<I", BOOTPROF_MAGIC)
+    offsets = []
+    offset = data.find(magic)
+    while offset >= 0:
+        if offset % 4 == 0:
+            offsets.append(offset)
+        offset = data.find(magic, offset + 1)
+    return offsets
+
+
+def decode(data, offset):
+    """Decode the record at offset, return the header and the phases."""
+    if offset + HEADER_SIZE > len(data):
+        raise ValueError("dump is too short for the record header")
+
+    magic, version, num_marks, count, boot_count = struct.unpack_from(HEADER_FORMAT, data, offset)
+
+    if magic != BOOTPROF_MAGIC:
+        raise ValueError("bad magic 0x%08X" % magic)
+    if version != BOOTPROF_VERSION:
+        raise ValueError("unsupported version %d" % version)
+    if count > num_marks:
+        raise ValueError("%d marks of %d" % (count, num_marks))
+    if offset + HEADER_SIZE + count * MARK_SIZE > len(data):
+        raise ValueError("dump is too short for %d marks" % count)
+
+    header = {"num_marks": num_marks, "count": count, "boot_count": boot_count}
+
+    # The first phase runs from the reset (MCYCLE 0), each one at the clock of its start
+    phases = []
+    cycles_from, freq_from = 0, 0
+    for index in range(count):
+        cycles, freq, mark_id = struct.unpack_from(MARK_FORMAT, data, offset + HEADER_SIZE + index * MARK_SIZE)
+        if index == 0:
+            freq_from = freq
+        delta = (cycles - cycles_from) & 0xFFFFFFFF
+        phases.append({
+            "id": mark_id,
+            "name": phase_name(mark_id),
+            "cycles": delta,
+            "us": delta * 1e6 / freq_from if freq_from else 0.0,
+            "freq": freq_from,
+        })
+        cycles_from, freq_from = cycles, freq
+
+    return header, phases
+
+
+def read_baseline(path):
+    """Phase times [us] of a --csv file."""
+    baseline = {}
+    with open(path, newline="") as csv_file:
+        for row in csv.DictReader(csv_file):
+            baseline[row["phase"]] = float(row["us"])
+    return baseline
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode the BOOTPROF records from a memory dump.")
+    parser.add_argument("dump", help="raw binary memory dump")
+    parser.add_argument("--offset", type=lambda x: int(x, 0), default=None,
+                        help="offset of a record in the dump (searched if not given)")
+    parser.add_argument("--csv", metavar="FILE", help="write the phases of the first record")
+    parser.add_argument("--baseline", metavar="FILE", help="compare the first record with a --csv file")
+    args = parser.parse_args()
+
+    with open(args.dump, "rb") as dump_file:
+        data = dump_file.read()
+
+    offsets = [args.offset] if args.offset is not None else find_records(data)
+    if not offsets:
+        sys.exit("BOOTPROF record is not found in %s" % args.dump)
+
+    baseline = read_baseline(args.baseline) if args.baseline else None
+
+    for number, offset in enumerate(offsets):
+        try:
+            header, phases = decode(data, offset)
+        except ValueError as error:
+            sys.exit("BOOTPROF record at offset 0x%X: %s" % (offset, error))
+
+        total_us = sum(phase["us"] for phase in phases)
+        print("BOOTPROF record at offset 0x%X: boot %d, %d marks%s, %.1f us to the last mark" %
+              (offset, header["boot_count"], header["count"],
+               " (full)" if header["count"] == header["num_marks"] else "", total_us))
+        print("%-24s %12s %12s %6s %12s%s" % ("Phase", "Cycles", "Time, us", "%", "Clock, Hz",
+                                              "  Baseline, us" if number == 0 and baseline else ""))
+        for phase in phases:
+            line = "%-24s %12d %12.1f %6.1f %12d" % (phase["name"], phase["cycles"], phase["us"],
+                                                     100.0 * phase["us"] / total_us if total_us else 0.0,
+                                                     phase["freq"])
+            if number == 0 and baseline and phase["name"] in baseline:
+                line += "  %12.1f %+7.1f%%" % (baseline[phase["name"]],
+                                               100.0 * (phase["us"] / baseline[phase["name"]] - 1)
+                                               if baseline[phase["name"]] else 0.0)
+            print(line)
+        print()
+
+        if number == 0 and args.csv:
+            with open(args.csv, "w", newline="") as csv_file:
+                writer = csv.writer(csv_file)
+                writer.writerow(["phase", "cycles", "us"])
+                for phase in phases:
+                    writer.writerow([phase["name"], phase["cycles"], "%.3f" % phase["us"]])
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
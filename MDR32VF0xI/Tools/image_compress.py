@@ -0,0 +1,317 @@
+#!/usr/bin/env python3
+"""
+Post-link packer of the startup copied sections (.text, .ramfunc, .data,
+.ahbram_data load images).
+
+The linker scripts place the load images of the __copy_table sections after
+the read-only data, at the end of the REGION_LOAD image. The packer builds the
+REGION_LOAD image of the linked ELF file, compresses these load images to LZ4
+blocks, stores them one after the other in place of the original images and
+patches their __copy_table load addresses, setting bit 0 (UNPACK_LZ4_FLAG).
+A section that does not get smaller is moved unpacked. The startup file built
+with STARTUP_USE_UNPACK = 1 expands the marked sections by UNPACK_LZ4.
+The overlay load images (__overlay_table) follow .ramfunc, they are moved
+unpacked and their descriptors are patched, OVERLAY_Load copies them by words.
+The .ramfunc_hot load image goes before .text, it is packed only if .text is
+copied too (REGION_TEXT is not REGION_LOAD).
+
+The packed image is meant for the linker scripts loading from FLASH
+(link_FLASH.ld, link_RAM_*_release.ld), the debug scripts are loaded to RAM by
+the debugger from the ELF file.
+
+Every LZ4 block is checked by the reference decoder below (the same steps as
+UNPACK_LZ4), --export writes the blocks and the original images, so
+system_MDR32VF0xI_unpack.c can be checked on the host with the same data.
+Tools/tests/test_unpack.py checks UNPACK_LZ4 built for the host against
+lz4_compress.
+
+Usage:
+
+    image_compress.py ELF -o BIN [--export DIR]
+
+BIN is the raw binary of REGION_LOAD from its lowest address, to be programmed
+instead of the ELF file, for example (OpenOCD):
+
+    flash write_image erase BIN <printed load address> bin
+
+Copyright (C) {YYYY} Milandr
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+SHT_PROGBITS = 1
+SHT_SYMTAB = 2
+SHF_ALLOC = 0x2
+PT_LOAD = 1
+
+UNPACK_LZ4_FLAG = 0x1
+
+# Sections of the linker scripts sized by the location counter only, they have no contents
+NO_CONTENTS = (".heap", ".irq_stack", ".stack")
+
+LZ4_MIN_MATCH = 4
+LZ4_MAX_OFFSET = 0xFFFF
+LZ4_LAST_LITERALS = 5
+LZ4_MFLIMIT = 12
+
+
+class Elf:
+    """Sections, segments and symbols of a 32-bit little-endian ELF file."""
+
+    def __init__(self, data):
+        if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+            raise ValueError("not a 32-bit little-endian ELF file")
+        (_type, _machine, _version, _entry, phoff, shoff, _flags, _ehsize,
+         phentsize, phnum, shentsize, shnum, shstrndx) = struct.unpack_from("<HHIIIIIHHHHHH", data, 16)
+        self.data = data
+        self.segments = [struct.unpack_from("<8I", data, phoff + i * phentsize) for i in range(phnum)]
+        headers = [struct.unpack_from("<10I", data, shoff + i * shentsize) for i in range(shnum)]
+        names = headers[shstrndx]
+        self.sections = []
+        for header in headers:
+            name_offset = names[4] + header[0]
+            name = data[name_offset:data.index(b"\0", name_offset)].decode()
+            self.sections.append({
+                "name": name, "type": header[1], "flags": header[2], "addr": header[3],
+                "offset": header[4], "size": header[5], "link": header[6],
+            })
+        self.symbols = {}
+        for section in self.sections:
+            if section["type"] != SHT_SYMTAB:
+                continue
+            strtab = self.sections[section["link"]]
+            for offset in range(section["offset"], section["offset"] + section["size"], 16):
+                name_index, value = struct.unpack_from("<II", data, offset)
+                name_offset = strtab["offset"] + name_index
+                self.symbols[data[name_offset:data.index(b"\0", name_offset)].decode()] = value
+
+    def load_address(self, section):
+        """Load address (LMA) of a section with contents."""
+        for (p_type, p_offset, p_vaddr, p_paddr, p_filesz, _memsz, _flags, _align) in self.segments:
+            if p_type == PT_LOAD and p_offset <= section["offset"] < p_offset + p_filesz:
+                return p_paddr + section["offset"] - p_offset
+        return None
+
+    def contents(self, section):
+        return self.data[section["offset"]:section["offset"] + section["size"]]
+
+
+def lz4_compress(data):
+    """Compress to an LZ4 block: greedy parsing, the last sequence has literals only."""
+    out = bytearray()
+    table = {}
+    size = len(data)
+    anchor = 0
+    pos = 0
+
+    def put_length(length):
+        while length >= 255:
+            out.append(255)
+            length -= 255
+        out.append(length)
+
+    while pos + LZ4_MFLIMIT <= size:
+        key = data[pos:pos + LZ4_MIN_MATCH]
+        candidate = table.get(key)
+        table[key] = pos
+        if candidate is None or pos - candidate > LZ4_MAX_OFFSET:
+            pos += 1
+            continue
+        length = LZ4_MIN_MATCH
+        limit = size - LZ4_LAST_LITERALS
+        while pos + length < limit and data[candidate + length] == data[pos + length]:
+            length += 1
+
+        literals = pos - anchor
+        token_literals = min(literals, 15)
+        token_match = min(length - LZ4_MIN_MATCH, 15)
+        out.append((token_literals << 4) | token_match)
+        if literals >= 15:
+            put_length(literals - 15)
+        out += data[anchor:pos]
+        out += struct.pack("<H", pos - candidate)
+        if length - LZ4_MIN_MATCH >= 15:
+            put_length(length - LZ4_MIN_MATCH - 15)
+
+        for index in range(pos + 1, min(pos + length, size - LZ4_MIN_MATCH)):
+            table[data[index:index + LZ4_MIN_MATCH]] = index
+        pos += length
+        anchor = pos
+
+    literals = size - anchor
+    out.append(min(literals, 15) << 4)
+    if literals >= 15:
+        put_length(literals - 15)
+    out += data[anchor:]
+    return bytes(out)
+
+
+def lz4_decompress(block, size):
+    """Reference decoder, the same steps as UNPACK_LZ4 (system_MDR32VF0xI_unpack.c)."""
+    out = bytearray()
+    src = 0
+    while True:
+        token = block[src]
+        src += 1
+        length = token >> 4
+        if length == 15:
+            while True:
+                byte = block[src]
+                src += 1
+                length += byte
+                if byte != 255:
+                    break
+        out += block[src:src + length]
+        src += length
+        if len(out) >= size:
+            break
+        offset = block[src] | (block[src + 1] << 8)
+        src += 2
+        if offset == 0 or offset > len(out):
+            raise ValueError("bad match offset %d at output %d" % (offset, len(out)))
+        length = (token & 0xF) + LZ4_MIN_MATCH
+        if token & 0xF == 15:
+            while True:
+                byte = block[src]
+                src += 1
+                length += byte
+                if byte != 255:
+                    break
+        for _ in range(length):
+            out.append(out[-offset])
+    if src != len(block):
+        raise ValueError("block end %d, expected %d" % (src, len(block)))
+    return bytes(out)
+
+
+def load_image(elf, table_lma):
+    """REGION_LOAD image: base address and contents, 0xFF in the gaps."""
+    window = table_lma >> 28
+    parts = []
+    for section in elf.sections:
+        if (section["type"] != SHT_PROGBITS or not section["flags"] & SHF_ALLOC or
+                section["size"] == 0 or section["name"] in NO_CONTENTS):
+            continue
+        lma = elf.load_address(section)
+        if lma is not None and lma >> 28 == window:
+            parts.append((lma, elf.contents(section)))
+    base = min(lma for lma, _ in parts)
+    end = max(lma + len(contents) for lma, contents in parts)
+    image = bytearray(b"\xff" * (end - base))
+    for lma, contents in parts:
+        image[lma - base:lma - base + len(contents)] = contents
+    return base, image
+
+
+def section_name(elf, start):
+    for section in elf.sections:
+        if section["flags"] & SHF_ALLOC and section["addr"] == start and section["size"] != 0:
+            return section["name"]
+    return "0x%08X" % start
+
+
+def align4(value):
+    return (value + 3) & ~3
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack the startup copied sections of a linked ELF file to LZ4.")
+    parser.add_argument("elf", help="linked ELF file")
+    parser.add_argument("-o", "--output", required=True, help="output raw binary of REGION_LOAD")
+    parser.add_argument("--export", metavar="DIR", help="write the LZ4 blocks and the original images to DIR")
+    args = parser.parse_args()
+
+    with open(args.elf, "rb") as elf_file:
+        try:
+            elf = Elf(elf_file.read())
+        except ValueError as error:
+            sys.exit("%s: %s" % (args.elf, error))
+
+    try:
+        table_start = elf.symbols["__copy_table_start"]
+        table_end = elf.symbols["__copy_table_end"]
+    except KeyError:
+        sys.exit("%s: __copy_table is not found, the linker script is too old" % args.elf)
+
+    table = next(s for s in elf.sections if s["name"] == ".copy_table")
+    table_lma = elf.load_address(table)
+    base, image = load_image(elf, table_lma)
+
+    # Descriptor tables: copy table (packed), overlay table (moved only)
+    tables = [(table_lma - base + table_start - table["addr"], table_end - table_start, True)]
+    overlay_table = next((s for s in elf.sections if s["name"] == ".overlay_table"), None)
+    if overlay_table is not None:
+        tables.append((elf.load_address(overlay_table) - base, overlay_table["size"], False))
+
+    descriptors = []
+    for table_offset, table_size, pack in tables:
+        for index in range(table_size // 12):
+            offset = table_offset + index * 12
+            load, start, end = struct.unpack_from("<3I", image, offset)
+            if load & UNPACK_LZ4_FLAG:
+                sys.exit("%s: the image is already packed" % args.elf)
+            if load != start and end > start:
+                name = section_name(elf, start) if pack else ".overlay%d" % index
+                descriptors.append({"offset": offset, "load": load, "start": start, "end": end,
+                                    "name": name, "pack": pack})
+
+    # Only the load images at the end of REGION_LOAD can be packed
+    tail = base + len(image)
+    packed = []
+    for descriptor in sorted(descriptors, key=lambda d: d["load"], reverse=True):
+        if align4(descriptor["load"] + descriptor["end"] - descriptor["start"]) != align4(tail):
+            break
+        packed.insert(0, descriptor)
+        tail = descriptor["load"]
+    for descriptor in descriptors:
+        if descriptor not in packed:
+            print("%-14s load image is not at the end of REGION_LOAD, left unpacked" % descriptor["name"])
+
+    output = image[:tail - base]
+    total_raw = 0
+    total_read = 0
+    print("%-14s %10s %10s %10s %6s" % ("Section", "Load", "Raw", "Stored", "Ratio"))
+    for descriptor in packed:
+        raw = bytes(image[descriptor["load"] - base:descriptor["load"] - base + descriptor["end"] - descriptor["start"]])
+        stored, flag = raw, 0
+        if descriptor["pack"]:
+            block = lz4_compress(raw)
+            try:
+                if lz4_decompress(block, len(raw)) != raw:
+                    raise ValueError("decoded data differs")
+            except (ValueError, IndexError) as error:
+                sys.exit("%s: LZ4 check failed: %s" % (descriptor["name"], error))
+            if len(block) < len(raw):
+                stored, flag = block, UNPACK_LZ4_FLAG
+            total_raw += len(raw)
+            total_read += len(stored)
+
+        load = base + len(output)
+        output += stored
+        output += b"\xff" * (align4(len(output)) - len(output))
+        struct.pack_into("<I", output, descriptor["offset"], load | flag)
+
+        print("%-14s 0x%08X %10d %10d %5.1f%%%s" % (descriptor["name"], load, len(raw), len(stored),
+                                                  100.0 * len(stored) / len(raw), "" if flag else " (unpacked)"))
+
+        if args.export and descriptor["pack"]:
+            os.makedirs(args.export, exist_ok=True)
+            name = descriptor["name"].lstrip(".")
+            with open(os.path.join(args.export, name + ".bin"), "wb") as raw_file:
+                raw_file.write(raw)
+            with open(os.path.join(args.export, name + ".lz4"), "wb") as block_file:
+                block_file.write(block)
+
+    with open(args.output, "wb") as output_file:
+        output_file.write(output)
+
+    print("Load address 0x%08X, image %d -> %d bytes, copied sections %d -> %d bytes read at boot" %
+          (base, len(image), len(output), total_raw, total_read))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
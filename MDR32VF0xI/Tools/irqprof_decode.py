@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+"""
+Decoder of the interrupt profiler (IRQPROF) statistics block.
+
+The block (IRQPROF_Block, system_MDR32VF0xI_irqprof.h) is kept in the .noinit
+section, so it can be read from a memory dump taken by a debugger after a stop
+or a warm reset, for example (OpenOCD):
+
+    dump_image irqprof.bin <address of IRQPROF_Block> <sizeof(IRQPROF_Block)>
+
+Usage:
+
+    irqprof_decode.py DUMP [--offset OFFSET] [--hist]
+
+DUMP is a raw binary memory dump. If OFFSET is not given, the dump is searched
+for the block magic at the word aligned offsets.
+
+Copyright (C) {YYYY} Milandr
+"""
+
+import argparse
+import struct
+import sys
+
+IRQPROF_MAGIC = 0x46525049
+IRQPROF_VERSION = 1
+
+HEADER_FORMAT = "<IHBBBBHI"
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+
+CLOCK_NAMES = {0: "MCYCLE", 1: "MTIME"}
+
+MDR1206_NAMES = {
+    0: "USIP", 3: "MSIP", 4: "UTIP", 7: "MTIP", 12: "CSIP",
+    16: "DMA", 17: "UART1", 18: "UART2", 19: "SSP1", 20: "POWER", 21: "WWDG",
+    22: "TIMER1", 23: "TIMER2", 24: "ADC", 25: "I2C", 26: "BKP", 27: "EXT_INT1",
+    28: "EXT_INT2", 29: "EXT_INT3", 30: "ADCUI_F03", 31: "ADCUI_F1", 32: "ADCUI_F2",
+    37: "RANDOM", 38: "USART", 39: "UART3", 40: "SSP2", 41: "SSP3", 42: "TIMER3",
+    43: "TIMER4", 44: "UART4",
+}
+
+MDR32F02_LOCAL_NAMES = {3: "MSIP", 7: "MTIP"}
+
+MDR32F02_EXT_NAMES = [
+    "DMA", "UART1", "UART2", "SSP1", "POWER", "WWDG", "TIMER1", "TIMER2", "ADC",
+    "I2C", "BKP", "EXT_INT1", "EXT_INT2", "EXT_INT3", "ADCUI_F03", "ADCUI_F1",
+    "ADCUI_F2", "L_BLOCK", "Reserved", "SENSORS", "CLK_MEASURE", "RANDOM", "USART",
+    "UART3", "SSP2", "SSP3", "TIMER3", "TIMER4", "UART4", "OTP",
+]
+
+
+def entry_size(hist_bins):
+    """Size of IRQPROF_Entry_TypeDef."""
+    return 5 * 4 + 2 * 2 * hist_bins
+
+
+def irq_name(index, ext_offset):
+    """Interrupt name of a statistics entry."""
+    if ext_offset == 0:
+        return MDR1206_NAMES.get(index, "IRQ%d" % index)
+    if index < ext_offset:
+        return MDR32F02_LOCAL_NAMES.get(index, "LOCAL%d" % index)
+    ext = index - ext_offset
+    if ext < len(MDR32F02_EXT_NAMES):
+        return MDR32F02_EXT_NAMES[ext]
+    return "EXT%d" % ext
+
+
+def find_block(data):
+    """Find the offset of the block magic in the dump."""
+    magic = struct.pack("<I", IRQPROF_MAGIC)
+    offset = data.find(magic)
+    while offset >= 0 and offset % 4 != 0:
+        offset = data.find(magic, offset + 1)
+    return offset
+
+
+def decode(data, offset):
+    """Decode the block at offset, return the header and the entries."""
+    if offset + HEADER_SIZE > len(data):
+        raise ValueError("dump is too short for the block header")
+
+    (magic, version, num_entries, hist_bins, clock, ext_offset,
+     _reserved, clock_freq) = struct.unpack_from(HEADER_FORMAT, data, offset)
+
+    if magic != IRQPROF_MAGIC:
+        raise ValueError("bad magic 0x%08X" % magic)
+    if version != IRQPROF_VERSION:
+        raise ValueError("unsupported version %d" % version)
+
+    size = entry_size(hist_bins)
+    if offset + HEADER_SIZE + num_entries * size > len(data):
+        raise ValueError("dump is too short for %d entries" % num_entries)
+
+    header = {
+        "num_entries": num_entries,
+        "hist_bins": hist_bins,
+        "clock": clock,
+        "ext_offset": ext_offset,
+        "clock_freq": clock_freq,
+    }
+
+    entries = []
+    entry_format = "<5I%dH%dH" % (hist_bins, hist_bins)
+    for index in range(num_entries):
+        fields = struct.unpack_from(entry_format, data, offset + HEADER_SIZE + index * size)
+        entries.append({
+            "index": index,
+            "count": fields[0],
+            "latency_min": fields[1],
+            "latency_max": fields[2],
+            "duration_min": fields[3],
+            "duration_max": fields[4],
+            "latency_hist": list(fields[5:5 + hist_bins]),
+            "duration_hist": list(fields[5 + hist_bins:]),
+        })
+
+    return header, entries
+
+
+def bin_range(bin_index, hist_bins):
+    """Value range of a histogram bin as a string."""
+    if bin_index == 0:
+        return "0"
+    low = 1 << (bin_index - 1)
+    if bin_index == hist_bins - 1:
+        return ">=%d" % low
+    return "%d..%d" % (low, (1 << bin_index) - 1)
+
+
+def hist_percentile(hist, fraction):
+    """Upper bound of the bin containing the given fraction of the samples."""
+    total = sum(hist)
+    if total == 0:
+        return 0
+    accumulated = 0
+    for bin_index, count in enumerate(hist):
+        accumulated += count
+        if accumulated >= total * fraction:
+            return 0 if bin_index == 0 else (1 << bin_index) - 1
+    return (1 << (len(hist) - 1)) - 1
+
+
+def format_time(ticks, clock_freq):
+    """Ticks with the time in microseconds if the frequency is known."""
+    if clock_freq == 0:
+        return "%d" % ticks
+    return "%d (%.2f us)" % (ticks, ticks * 1e6 / clock_freq)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode the IRQPROF statistics block from a memory dump.")
+    parser.add_argument("dump", help="raw binary memory dump")
+    parser.add_argument("--offset", type=lambda x: int(x, 0), default=None,
+                        help="offset of IRQPROF_Block in the dump (searched if not given)")
+    parser.add_argument("--hist", action="store_true", help="print the histograms")
+    args = parser.parse_args()
+
+    with open(args.dump, "rb") as dump_file:
+        data = dump_file.read()
+
+    offset = args.offset if args.offset is not None else find_block(data)
+    if offset < 0:
+        sys.exit("IRQPROF block is not found in %s" % args.dump)
+
+    try:
+        header, entries = decode(data, offset)
+    except ValueError as error:
+        sys.exit("IRQPROF block at offset 0x%X: %s" % (offset, error))
+
+    freq = header["clock_freq"]
+    print("IRQPROF block at offset 0x%X: %d entries, clock %s, %d Hz" %
+          (offset, header["num_entries"], CLOCK_NAMES.get(header["clock"], "?"), freq))
+    print("%-5s %-12s %10s  %-22s %-22s %-8s  %-22s %-22s %-8s" %
+          ("Index", "IRQ", "Count", "Latency min", "Latency max", "p99<=",
+           "Duration min", "Duration max", "p99<="))
+
+    for entry in entries:
+        if entry["count"] == 0:
+            continue
+        print("%-5d %-12s %10d  %-22s %-22s %-8d  %-22s %-22s %-8d" %
+              (entry["index"], irq_name(entry["index"], header["ext_offset"]), entry["count"],
+               format_time(entry["latency_min"], freq), format_time(entry["latency_max"], freq),
+               hist_percentile(entry["latency_hist"], 0.99),
+               format_time(entry["duration_min"], freq), format_time(entry["duration_max"], freq),
+               hist_percentile(entry["duration_hist"], 0.99)))
+        if args.hist:
+            for bin_index in range(header["hist_bins"]):
+                latency = entry["latency_hist"][bin_index]
+                duration = entry["duration_hist"][bin_index]
+                if latency or duration:
+                    print("      %-14s latency %6d  duration %6d" %
+                          (bin_range(bin_index, header["hist_bins"]), latency, duration))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
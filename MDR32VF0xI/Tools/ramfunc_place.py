@@ -0,0 +1,281 @@
+#!/usr/bin/env python3
+"""
+Profile-guided placement of the hot functions into REGION_RAMFUNC (.ramfunc_hot).
+
+The profile is the function profiler (FUNCPROF) block of a build with
+USE_FUNCPROF = 1 and the application sources compiled with
+-finstrument-functions. The block (FUNCPROF_Block, system_MDR32VF0xI_funcprof.h)
+is kept in the .noinit section, so it can be read from a memory dump taken by
+a debugger after FUNCPROF_Stop, for example (OpenOCD):
+
+    dump_image funcprof.bin <address of FUNCPROF_Block> <sizeof(FUNCPROF_Block)>
+
+Usage:
+
+    ramfunc_place.py ELF DUMP [--offset OFFSET] [--budget BYTES] [--region-size BYTES]
+                     [--tcm-ratio RATIO] [--fragment FILE] [--script IN --script-out OUT]
+                     [--top N]
+
+ELF is the profiled (instrumented) ELF file. The functions running from
+REGION_TEXT (.text) or already placed into .ramfunc_hot are ordered by their
+self cycles per byte and taken while they fit in the budget, which is the
+REGION_RAMFUNC size less .ramfunc and the largest overlay by default.
+--fragment writes the input section list of .ramfunc_hot, --script copies
+a linker script with the list inserted between its RAMFUNC_HOT_BEGIN and
+RAMFUNC_HOT_END markers. The sections are named .text.<function>, so the
+release build should be compiled with -ffunction-sections (the static
+functions of the same name in several files are all placed).
+
+The expected speedup is estimated for the profiled run: the placed self
+cycles are scaled by --tcm-ratio (the cycles of the same code from TCM to the
+cycles from FLASH, 0.5 for one FLASH wait state per instruction fetch by
+default), the other cycles are kept. The calls from FLASH to TCM use the long
+call sequence, this is not counted.
+
+Copyright (C) {YYYY} Milandr
+"""
+
+import argparse
+import struct
+import sys
+
+FUNCPROF_MAGIC = 0x46525046
+FUNCPROF_VERSION = 1
+
+HEADER_FORMAT = "<IHHBBHIIIII"
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+ENTRY_FORMAT = "<IIQ"
+ENTRY_SIZE = struct.calcsize(ENTRY_FORMAT)
+
+SHT_SYMTAB = 2
+STT_FUNC = 2
+
+# Sections of the functions that can be moved, the others are already in RAM or not profiled
+MOVABLE_SECTIONS = (".text", ".ramfunc_hot")
+
+RAMFUNC_HOT_BEGIN = "/* RAMFUNC_HOT_BEGIN */"
+RAMFUNC_HOT_END = "/* RAMFUNC_HOT_END */"
+
+
+class Elf:
+    """Sections and symbols of a 32-bit little-endian ELF file."""
+
+    def __init__(self, data):
+        if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+            raise ValueError("not a 32-bit little-endian ELF file")
+        (_type, _machine, _version, _entry, _phoff, shoff, _flags, _ehsize,
+         _phentsize, _phnum, shentsize, shnum, shstrndx) = struct.unpack_from("<HHIIIIIHHHHHH", data, 16)
+        headers = [struct.unpack_from("<10I", data, shoff + i * shentsize) for i in range(shnum)]
+        names = headers[shstrndx]
+        self.sections = []
+        for header in headers:
+            name_offset = names[4] + header[0]
+            self.sections.append({
+                "name": data[name_offset:data.index(b"\0", name_offset)].decode(),
+                "type": header[1], "addr": header[3], "offset": header[4], "size": header[5], "link": header[6],
+            })
+        self.symbols = {}
+        self.functions = []
+        for section in self.sections:
+            if section["type"] != SHT_SYMTAB:
+                continue
+            strtab = self.sections[section["link"]]
+            for offset in range(section["offset"], section["offset"] + section["size"], 16):
+                name_index, value, size, info, _other, shndx = struct.unpack_from("<IIIBBH", data, offset)
+                name_offset = strtab["offset"] + name_index
+                name = data[name_offset:data.index(b"\0", name_offset)].decode()
+                self.symbols[name] = value
+                if info & 0xF == STT_FUNC and 0 < shndx < len(self.sections):
+                    self.functions.append({"name": name, "addr": value, "size": size,
+                                           "section": self.sections[shndx]["name"]})
+
+
+def find_block(data):
+    """Offset of the block magic in the dump."""
+    magic = struct.pack("<I", FUNCPROF_MAGIC)
+    offset = data.find(magic)
+    while offset >= 0 and offset % 4 != 0:
+        offset = data.find(magic, offset + 1)
+    return offset
+
+
+def decode(data, offset):
+    """Decode the block at offset, return the header and the used entries."""
+    if offset + HEADER_SIZE > len(data):
+        raise ValueError("dump is too short for the block header")
+
+    (magic, version, num_entries, stack_depth, running, _reserved, clock_freq,
+     calls, dropped, overflows, _depth) = struct.unpack_from(HEADER_FORMAT, data, offset)
+
+    if magic != FUNCPROF_MAGIC:
+        raise ValueError("bad magic 0x%08X" % magic)
+    if version != FUNCPROF_VERSION:
+        raise ValueError("unsupported version %d" % version)
+    if offset + HEADER_SIZE + num_entries * ENTRY_SIZE > len(data):
+        raise ValueError("dump is too short for %d entries" % num_entries)
+
+    header = {"num_entries": num_entries, "stack_depth": stack_depth, "running": running,
+              "clock_freq": clock_freq, "calls": calls, "dropped": dropped, "overflows": overflows}
+    entries = []
+    for index in range(num_entries):
+        func, count, cycles = struct.unpack_from(ENTRY_FORMAT, data, offset + HEADER_SIZE + index * ENTRY_SIZE)
+        if func != 0:
+            entries.append({"func": func, "calls": count, "cycles": cycles})
+    return header, entries
+
+
+def align4(value):
+    return (value + 3) & ~3
+
+
+def default_budget(elf, region_size):
+    """REGION_RAMFUNC bytes left by .ramfunc and the overlays."""
+    try:
+        hot_size = elf.symbols["__ramfunc_hot_end"] - elf.symbols["__ramfunc_hot_start"]
+        used = elf.symbols["__overlay_end"] - elf.symbols["__ramfunc_hot_start"] - hot_size
+    except KeyError:
+        sys.exit("__ramfunc_hot is not found, the linker script is too old")
+    return region_size - used
+
+
+def profile_functions(elf, entries):
+    """Profiled functions grouped by name (the section name of -ffunction-sections)."""
+    by_addr = {}
+    for function in elf.functions:
+        by_addr.setdefault(function["addr"] & ~1, function)
+
+    functions = {}
+    unknown = 0
+    for entry in entries:
+        symbol = by_addr.get(entry["func"] & ~1)
+        if symbol is None:
+            unknown += entry["cycles"]
+            continue
+        function = functions.setdefault(symbol["name"], {
+            "name": symbol["name"], "calls": 0, "cycles": 0, "size": 0,
+            "movable": symbol["section"] in MOVABLE_SECTIONS, "section": symbol["section"],
+        })
+        function["calls"] += entry["calls"]
+        function["cycles"] += entry["cycles"]
+
+    # All the functions of a name go to .ramfunc_hot together
+    for symbol in elf.functions:
+        if symbol["name"] in functions:
+            functions[symbol["name"]]["size"] += align4(symbol["size"])
+    return list(functions.values()), unknown
+
+
+def place(functions, budget):
+    """Greedy placement by the self cycles per byte, return the placed functions in the order."""
+    candidates = [f for f in functions if f["movable"] and f["cycles"] > 0 and f["size"] > 0]
+    candidates.sort(key=lambda f: (-f["cycles"] / f["size"], f["name"]))
+    placed, used = [], 0
+    for function in candidates:
+        if used + function["size"] <= budget:
+            placed.append(function)
+            used += function["size"]
+    return placed, used
+
+
+def fragment_lines(placed):
+    return ["        *(.text.%s)" % function["name"] for function in placed]
+
+
+def write_script(path_in, path_out, lines):
+    """Copy a linker script with the lines between the markers replaced."""
+    with open(path_in) as script_file:
+        script = script_file.read().split("\n")
+    try:
+        begin = next(i for i, line in enumerate(script) if line.strip() == RAMFUNC_HOT_BEGIN)
+        end = next(i for i, line in enumerate(script) if i > begin and line.strip() == RAMFUNC_HOT_END)
+    except StopIteration:
+        sys.exit("%s: the RAMFUNC_HOT markers are not found" % path_in)
+    with open(path_out, "w") as script_file:
+        script_file.write("\n".join(script[:begin + 1] + lines + script[end:]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Place the hot functions of a FUNCPROF profile into .ramfunc_hot.")
+    parser.add_argument("elf", help="profiled ELF file")
+    parser.add_argument("dump", help="raw binary memory dump of FUNCPROF_Block")
+    parser.add_argument("--offset", type=lambda x: int(x, 0), default=None,
+                        help="offset of the block in the dump (searched if not given)")
+    parser.add_argument("--budget", type=lambda x: int(x, 0), default=None,
+                        help="bytes of .ramfunc_hot (REGION_RAMFUNC left by .ramfunc and the overlays if not given)")
+    parser.add_argument("--region-size", type=lambda x: int(x, 0), default=0x8000,
+                        help="REGION_RAMFUNC size for the default budget (RAM_TCMB, 32K)")
+    parser.add_argument("--tcm-ratio", type=float, default=0.5,
+                        help="cycles of the code from TCM to the cycles from FLASH (0.5)")
+    parser.add_argument("--fragment", metavar="FILE", help="write the .ramfunc_hot input section list")
+    parser.add_argument("--script", metavar="IN", help="linker script to insert the list into")
+    parser.add_argument("--script-out", metavar="OUT", help="output linker script (--script)")
+    parser.add_argument("--top", type=int, default=20, help="number of the functions in the report (20)")
+    args = parser.parse_args()
+
+    if bool(args.script) != bool(args.script_out):
+        parser.error("--script and --script-out go together")
+
+    with open(args.elf, "rb") as elf_file:
+        try:
+            elf = Elf(elf_file.read())
+        except ValueError as error:
+            sys.exit("%s: %s" % (args.elf, error))
+    with open(args.dump, "rb") as dump_file:
+        data = dump_file.read()
+
+    offset = args.offset if args.offset is not None else find_block(data)
+    if offset < 0:
+        sys.exit("FUNCPROF block is not found in %s" % args.dump)
+    try:
+        header, entries = decode(data, offset)
+    except ValueError as error:
+        sys.exit("FUNCPROF block at offset 0x%X: %s" % (offset, error))
+
+    functions, unknown = profile_functions(elf, entries)
+    total = sum(f["cycles"] for f in functions) + unknown
+    budget = args.budget if args.budget is not None else default_budget(elf, args.region_size)
+    placed, used = place(functions, max(budget, 0))
+    placed_names = set(f["name"] for f in placed)
+    placed_cycles = sum(f["cycles"] for f in placed)
+
+    print("FUNCPROF block at offset 0x%X: %d calls, %d functions, %d cycles%s" %
+          (offset, header["calls"], len(entries), total, " (still running)" if header["running"] else ""))
+    if header["dropped"]:
+        print("Warning: %d calls dropped, the table of %d entries is full" % (header["dropped"], header["num_entries"]))
+    if header["overflows"]:
+        print("Warning: %d calls deeper than %d, counted in their callers" % (header["overflows"], header["stack_depth"]))
+    if unknown:
+        print("Warning: %d cycles of the addresses not found in %s" % (unknown, args.elf))
+    print()
+
+    print("%-32s %10s %12s %6s %7s %-8s" % ("Function", "Calls", "Self cycles", "%", "Size", "Place"))
+    for function in sorted(functions, key=lambda f: -f["cycles"])[:args.top]:
+        where = ("TCM" if function["name"] in placed_names else
+                 "FLASH" if function["movable"] else function["section"])
+        print("%-32s %10d %12d %6.1f %7d %-8s" % (function["name"], function["calls"], function["cycles"],
+                                                  100.0 * function["cycles"] / total if total else 0.0,
+                                                  function["size"], where))
+    print()
+
+    fraction = placed_cycles / total if total else 0.0
+    estimate = total - placed_cycles * (1.0 - args.tcm_ratio)
+    print("Placed %d functions, %d of %d bytes, %.1f%% of the profiled cycles" %
+          (len(placed), used, budget, 100.0 * fraction))
+    print("Expected speedup at TCM/FLASH ratio %.2f: %.3fx (%d -> %d cycles%s)" %
+          (args.tcm_ratio, 1.0 / (1.0 - fraction * (1.0 - args.tcm_ratio)) if total else 1.0,
+           total, estimate,
+           ", %.1f -> %.1f ms" % (1e3 * total / header["clock_freq"], 1e3 * estimate / header["clock_freq"])
+           if header["clock_freq"] else ""))
+
+    lines = fragment_lines(placed)
+    if args.fragment:
+        with open(args.fragment, "w") as fragment_file:
+            fragment_file.write("\n".join(lines) + "\n")
+    if args.script:
+        write_script(args.script, args.script_out, lines)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
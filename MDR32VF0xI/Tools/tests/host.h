@@ -0,0 +1,135 @@
+/**
+ *******************************************************************************
+ * @file    host.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   Host build of the device support sources for the tests (run_tests.py):
+ *          CSR emulation and checks. Included by a test after
+ *          system_MDR32VF0xI_config.h and before the module headers and
+ *          sources, so that their inline functions use the emulated CSRs.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+#ifndef HOST_H
+#define HOST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief HOST CSR access operations.
+ */
+typedef enum {
+    HOST_CSR_READ,
+    HOST_CSR_WRITE,
+    HOST_CSR_SET,
+    HOST_CSR_CLEAR
+} HOST_CsrOp_TypeDef;
+
+/**
+ * @brief HOST CSR values by the CSR number.
+ */
+static uint_xlen_t HOST_Csr[4096];
+
+/**
+ * @brief HOST hook called after every CSR access (NULL if not used),
+ *        for example to take an interrupt when MSTATUS.MIE is set.
+ */
+static void (*HOST_CsrHook)(uint32_t Reg, HOST_CsrOp_TypeDef Op);
+
+/**
+ * @brief HOST number of the failed checks.
+ */
+static int HOST_Failures;
+
+/**
+ * @brief  Access an emulated CSR.
+ * @param  Reg: CSR number.
+ * @param  Value: Value to write, the mask to set or to clear.
+ * @param  Op: Access operation.
+ * @return CSR value before the access.
+ */
+__attribute__((no_instrument_function))
+static uint_xlen_t HOST_CsrAccess(uint32_t Reg, uint_xlen_t Value, HOST_CsrOp_TypeDef Op)
+{
+    uint_xlen_t Old = HOST_Csr[Reg & 0xFFF];
+
+    switch (Op) {
+        case HOST_CSR_WRITE:
+            HOST_Csr[Reg & 0xFFF] = Value;
+            break;
+        case HOST_CSR_SET:
+            HOST_Csr[Reg & 0xFFF] = Old | Value;
+            break;
+        case HOST_CSR_CLEAR:
+            HOST_Csr[Reg & 0xFFF] = Old & ~Value;
+            break;
+        default:
+            break;
+    }
+    if (HOST_CsrHook != NULL) {
+        HOST_CsrHook(Reg & 0xFFF, Op);
+    }
+
+    return Old;
+}
+
+/* Upper halves of the RV32 counters (the host build has __riscv_xlen = 64). */
+#ifndef CSR_CYCLEH
+#define CSR_CYCLEH    (0xC80)
+#define CSR_TIMEH     (0xC81)
+#define CSR_INSTRETH  (0xC82)
+#define CSR_MCYCLEH   (0xB80)
+#define CSR_MINSTRETH (0xB82)
+#endif
+
+#undef csr_read
+#undef csr_write
+#undef csr_read_write
+#undef csr_set_bits
+#undef csr_read_set_bits
+#undef csr_clear_bits
+#undef csr_read_clear_bits
+
+#define csr_read(reg)                  HOST_CsrAccess((reg), 0, HOST_CSR_READ)
+#define csr_write(reg, val)            ((void)HOST_CsrAccess((reg), (uint_xlen_t)(val), HOST_CSR_WRITE))
+#define csr_read_write(reg, val)       HOST_CsrAccess((reg), (uint_xlen_t)(val), HOST_CSR_WRITE)
+#define csr_set_bits(reg, mask)        ((void)HOST_CsrAccess((reg), (uint_xlen_t)(mask), HOST_CSR_SET))
+#define csr_read_set_bits(reg, mask)   HOST_CsrAccess((reg), (uint_xlen_t)(mask), HOST_CSR_SET)
+#define csr_clear_bits(reg, mask)      ((void)HOST_CsrAccess((reg), (uint_xlen_t)(mask), HOST_CSR_CLEAR))
+#define csr_read_clear_bits(reg, mask) HOST_CsrAccess((reg), (uint_xlen_t)(mask), HOST_CSR_CLEAR)
+
+/**
+ * @brief Check a condition, count and print the failure.
+ */
+#define HOST_CHECK(COND)                                                          \
+    do {                                                                          \
+        if (!(COND)) {                                                            \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #COND);       \
+            HOST_Failures++;                                                      \
+        }                                                                         \
+    } while (0)
+
+/**
+ * @brief Result of a test: the exit code of main.
+ */
+#define HOST_RESULT() (HOST_Failures != 0)
+
+#endif /* HOST_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE host.h */
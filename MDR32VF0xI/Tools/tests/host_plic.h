@@ -0,0 +1,180 @@
+/**
+ *******************************************************************************
+ * @file    host_plic.h
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   Host stand-in of the PLIC registers for the tests (run_tests.py):
+ *          the source priorities, the pending and the enable bits, the priority
+ *          threshold and the claim/complete register. Included by a test before
+ *          system_MDR32VF0xI_config.h, so that the inline functions of
+ *          core_plic.h access it through PLIC_READ_REG and PLIC_WRITE_REG.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+#ifndef HOST_PLIC_H
+#define HOST_PLIC_H
+
+#include <stdint.h>
+
+/**
+ * @brief HOST number of the PLIC source IDs (ID 0 is "no interrupt").
+ */
+#define HOST_PLIC_NUM_IDS 64
+
+/**
+ * @brief HOST PLIC register offsets from the PLIC base address.
+ */
+#define HOST_PLIC_IPB  0x1000UL
+#define HOST_PLIC_IEB  0x2000UL
+#define HOST_PLIC_PTHR 0x200000UL
+#define HOST_PLIC_ICR  0x200004UL
+
+/**
+ * @brief HOST PLIC register offset of an address (the PLIC takes 4 MiB).
+ */
+#define HOST_PLIC_OFFSET(ADDR) ((ADDR) & 0x3FFFFFUL)
+
+/**
+ * @brief HOST PLIC state.
+ */
+typedef struct {
+    uint32_t Priority[HOST_PLIC_NUM_IDS]; /*!< Source priorities by the source ID. */
+    uint32_t Pending[HOST_PLIC_NUM_IDS / 32];
+    uint32_t Enable[HOST_PLIC_NUM_IDS / 32];
+    uint32_t Threshold;
+    uint32_t Claimed[HOST_PLIC_NUM_IDS]; /*!< 1 if the source is claimed and not completed. */
+    uint32_t Claims;                     /*!< Number of the ICR reads. */
+    uint32_t Completes;                  /*!< Number of the ICR writes. */
+    uint32_t BadCompletes;               /*!< Number of the completions of a source not claimed. */
+} HOST_Plic_TypeDef;
+
+static HOST_Plic_TypeDef HOST_Plic;
+
+/**
+ * @brief  Find the enabled pending source of the highest priority above
+ *         the threshold (the lowest ID on a tie), that is the source the PLIC
+ *         interrupt request stands for.
+ * @param  None.
+ * @return Source ID, 0 if there is none.
+ */
+__attribute__((no_instrument_function)) static uint32_t HOST_PlicBest(void)
+{
+    uint32_t ID, Best = 0;
+
+    for (ID = 1; ID < HOST_PLIC_NUM_IDS; ID++) {
+        if ((((HOST_Plic.Pending[ID / 32] & HOST_Plic.Enable[ID / 32]) >> (ID % 32)) & 1) == 0) {
+            continue;
+        }
+        if ((HOST_Plic.Priority[ID] > HOST_Plic.Threshold) &&
+            ((Best == 0) || (HOST_Plic.Priority[ID] > HOST_Plic.Priority[Best]))) {
+            Best = ID;
+        }
+    }
+
+    return Best;
+}
+
+/**
+ * @brief  Claim the source found by HOST_PlicBest and clear its pending bit.
+ * @param  None.
+ * @return Source ID, 0 if there is none.
+ */
+__attribute__((no_instrument_function)) static uint32_t HOST_PlicClaim(void)
+{
+    uint32_t Best = HOST_PlicBest();
+
+    if (Best != 0) {
+        HOST_Plic.Pending[Best / 32] &= ~(1UL << (Best % 32));
+        HOST_Plic.Claimed[Best] = 1;
+    }
+
+    return Best;
+}
+
+/**
+ * @brief  Read a PLIC register.
+ * @param  Addr: Register address.
+ * @return Register value.
+ */
+__attribute__((no_instrument_function)) static uint32_t HOST_PlicRead(uintptr_t Addr)
+{
+    uintptr_t Offset = HOST_PLIC_OFFSET(Addr);
+
+    if (Offset == HOST_PLIC_ICR) {
+        HOST_Plic.Claims++;
+        return HOST_PlicClaim();
+    }
+    if (Offset == HOST_PLIC_PTHR) {
+        return HOST_Plic.Threshold;
+    }
+    if ((Offset >= HOST_PLIC_IEB) && (Offset < HOST_PLIC_IEB + sizeof(HOST_Plic.Enable))) {
+        return HOST_Plic.Enable[(Offset - HOST_PLIC_IEB) / 4];
+    }
+    if ((Offset >= HOST_PLIC_IPB) && (Offset < HOST_PLIC_IPB + sizeof(HOST_Plic.Pending))) {
+        return HOST_Plic.Pending[(Offset - HOST_PLIC_IPB) / 4];
+    }
+    if ((Offset < sizeof(HOST_Plic.Priority)) && ((Offset % 4) == 0)) {
+        return HOST_Plic.Priority[Offset / 4];
+    }
+
+    return 0;
+}
+
+/**
+ * @brief  Write a PLIC register.
+ * @param  Addr: Register address.
+ * @param  Value: Value to write.
+ * @return None.
+ */
+__attribute__((no_instrument_function)) static void HOST_PlicWrite(uintptr_t Addr, uint32_t Value)
+{
+    uintptr_t Offset = HOST_PLIC_OFFSET(Addr);
+
+    if (Offset == HOST_PLIC_ICR) {
+        HOST_Plic.Completes++;
+        if ((Value >= HOST_PLIC_NUM_IDS) || (HOST_Plic.Claimed[Value] == 0)) {
+            HOST_Plic.BadCompletes++;
+        } else {
+            HOST_Plic.Claimed[Value] = 0;
+        }
+    } else if (Offset == HOST_PLIC_PTHR) {
+        HOST_Plic.Threshold = Value;
+    } else if ((Offset >= HOST_PLIC_IEB) && (Offset < HOST_PLIC_IEB + sizeof(HOST_Plic.Enable))) {
+        HOST_Plic.Enable[(Offset - HOST_PLIC_IEB) / 4] = Value;
+    } else if ((Offset >= HOST_PLIC_IPB) && (Offset < HOST_PLIC_IPB + sizeof(HOST_Plic.Pending))) {
+        HOST_Plic.Pending[(Offset - HOST_PLIC_IPB) / 4] = Value;
+    } else if ((Offset < sizeof(HOST_Plic.Priority)) && ((Offset % 4) == 0)) {
+        HOST_Plic.Priority[Offset / 4] = Value;
+    }
+}
+
+/**
+ * @brief  Set a source pending.
+ * @param  ID: Source ID (IRQn + 1).
+ * @return None.
+ */
+__attribute__((no_instrument_function)) static void HOST_PlicRaise(uint32_t ID)
+{
+    HOST_Plic.Pending[ID / 32] |= 1UL << (ID % 32);
+}
+
+#define PLIC_READ_REG(ADDR)       HOST_PlicRead((uintptr_t)(ADDR))
+#define PLIC_WRITE_REG(ADDR, VAL) HOST_PlicWrite((uintptr_t)(ADDR), (uint32_t)(VAL))
+
+#endif /* HOST_PLIC_H */
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE host_plic.h */
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+"""
+Host tests of the device support sources and the tools.
+
+A test_*.c file defines the configuration switches it needs, includes
+system_MDR32VF0xI_config.h, host.h (host CSRs and checks) and the module
+sources, and
+returns non-zero on a failure. A line "HOST_CFLAGS: <flags>" in a C test adds
+the flags to its build (for example, -finstrument-functions). Every C test is built by the host GCC for each
+MCU of MCUS with a copy of system_MDR32VF0xI_config.h selecting the MCU
+(without the SPL, __riscv_xlen = 64 so that the host pointers fit in
+uint_xlen_t) and run. A test_*.py file is run by the Python interpreter.
+
+Usage:
+
+    run_tests.py [PATTERN ...] [--cc CC] [--keep DIR]
+
+PATTERN selects the tests by a substring of the file name.
+
+Copyright (C) {YYYY} Milandr
+"""
+
+import argparse
+import glob
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+TESTS_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(os.path.dirname(TESTS_DIR))
+
+MCUS = ("USE_MDR1206", "USE_MDR32F02_REV_2")
+
+CFLAGS = [
+    "-std=gnu11", "-O1", "-g", "-Wall", "-Wextra", "-Wno-unused-parameter", "-Wno-unused-function",
+    "-D__riscv_xlen=64", "-D__INTERRUPT_MACHINE=", "-D__INTERRUPT_SUPERVISOR=", "-D__INTERRUPT_USER=",
+]
+
+
+def write_config(directory, mcu):
+    """Copy of the configuration header selecting the MCU, without the SPL."""
+    with open(os.path.join(ROOT, "DeviceSupport", "system_MDR32VF0xI_config.h")) as config_file:
+        config = config_file.read()
+    config = re.sub(r"^#define USE_MDR32VF0xI_SPL", "// #define USE_MDR32VF0xI_SPL", config, flags=re.M)
+    config = re.sub(r"^#define USE_MDR1206$", "#define " + mcu, config, flags=re.M)
+    os.makedirs(directory, exist_ok=True)
+    with open(os.path.join(directory, "system_MDR32VF0xI_config.h"), "w") as config_file:
+        config_file.write(config)
+
+
+def run_c_test(cc, source, build):
+    """Build and run a C test for every MCU, return the failed MCUs."""
+    failed = []
+    name = os.path.splitext(os.path.basename(source))[0]
+    with open(source) as source_file:
+        extra = re.search(r"HOST_CFLAGS:(.*)$", source_file.read(), flags=re.M)
+    extra = extra.group(1).split() if extra else []
+    for mcu in MCUS:
+        config = os.path.join(build, mcu)
+        binary = os.path.join(build, "%s_%s" % (name, mcu))
+        command = [cc] + CFLAGS + extra + [
+            "-I" + config, "-I" + TESTS_DIR,
+            "-I" + os.path.join(ROOT, "DeviceSupport", "inc"), "-I" + os.path.join(ROOT, "CoreSupport", "inc"),
+            "-I" + os.path.join(ROOT, "DeviceSupport"), "-I" + os.path.join(ROOT, "DeviceSupport", "src"),
+            source, "-o", binary,
+        ]
+        result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+        if result.returncode != 0 or "warning:" in result.stdout:
+            print(result.stdout, end="")
+            failed.append(mcu + " (build)")
+            continue
+        result = subprocess.run([binary], stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+        if result.returncode != 0:
+            print(result.stdout, end="")
+            failed.append(mcu)
+    return failed
+
+
+def run_py_test(source):
+    """Run a Python test, return the failures."""
+    result = subprocess.run([sys.executable, source], stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+    if result.returncode != 0:
+        print(result.stdout, end="")
+        return ["python"]
+    return []
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run the host tests.")
+    parser.add_argument("patterns", nargs="*", help="substrings of the test file names")
+    parser.add_argument("--cc", default="gcc", help="host C compiler (gcc)")
+    parser.add_argument("--keep", metavar="DIR", help="build in DIR and keep it")
+    args = parser.parse_args()
+
+    tests = sorted(glob.glob(os.path.join(TESTS_DIR, "test_*.c")) + glob.glob(os.path.join(TESTS_DIR, "test_*.py")))
+    if args.patterns:
+        tests = [t for t in tests if any(p in os.path.basename(t) for p in args.patterns)]
+
+    build = args.keep or tempfile.mkdtemp(prefix="mdr32vf0xi_tests_")
+    for mcu in MCUS:
+        write_config(os.path.join(build, mcu), mcu)
+
+    failures = 0
+    for test in tests:
+        if test.endswith(".c"):
+            failed = run_c_test(args.cc, test, build)
+        else:
+            failed = run_py_test(test)
+        print("%-40s %s" % (os.path.basename(test), "FAILED: " + ", ".join(failed) if failed else "ok"))
+        failures += len(failed) != 0
+
+    if not args.keep:
+        shutil.rmtree(build)
+
+    print("%d of %d tests failed" % (failures, len(tests)) if failures else "All %d tests passed" % len(tests))
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
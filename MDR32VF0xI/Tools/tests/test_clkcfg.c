@@ -0,0 +1,185 @@
+/**
+ *******************************************************************************
+ * @file    test_clkcfg.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   Host test of the clock configuration solver (CLKCFG): the HSE and
+ *          the HSI solutions against the limits and an exhaustive search,
+ *          the ties, the unreachable targets, the FLASH wait states and
+ *          the CPU_C3 divider, and the HSI fallback of SystemClockConfig.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+#define CLKTREE_STATIC 0
+#define CLKCFG_USE_HSE 1
+
+#include "system_MDR32VF0xI_config.h"
+#include "host.h"
+
+static MDR_RST_CLK_TypeDef HOST_RstClk;
+static MDR_FLASH_TypeDef   HOST_Flash;
+
+#undef MDR_RST_CLK
+#undef MDR_FLASH
+#define MDR_RST_CLK (&HOST_RstClk)
+#define MDR_FLASH   (&HOST_Flash)
+
+#include "system_MDR32VF0xI_clkcfg.c"
+
+#define HSE_Hz          8000000UL
+#define HSI_MEASURED_Hz 7900000UL
+
+uint32_t SystemCoreClock = 8000000;
+uint32_t SystemHSIClock  = HSI_MEASURED_Hz;
+
+static uint32_t CoreClockUpdates;
+
+void SystemCoreClockUpdate(void)
+{
+    CoreClockUpdates++;
+}
+
+/* CPU_C1 frequency of a configuration. */
+static uint32_t C1Frequency(const CLKCFG_Config_TypeDef* Config, uint32_t SourceFreq)
+{
+    if ((Config->CPU_C1Sel == RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSI_DIV_2) ||
+        (Config->CPU_C1Sel == RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSE_DIV_2)) {
+        return SourceFreq / 2;
+    }
+    return SourceFreq;
+}
+
+/* CPU_C2 frequency of a configuration. */
+static uint32_t C2Frequency(const CLKCFG_Config_TypeDef* Config, uint32_t SourceFreq)
+{
+    return C1Frequency(Config, SourceFreq) * ((Config->PLLMul == 0) ? 1 : Config->PLLMul);
+}
+
+/* Check a solution against the limits and an exhaustive search of the clock tree. */
+static void CheckSolution(CLKCFG_Source_TypeDef Source, uint32_t SourceFreq, uint32_t TargetFreq)
+{
+    CLKCFG_Config_TypeDef Config;
+    ErrorStatus           Status;
+    uint32_t              Limit, C1Div, Mul, Div, C2Freq, Freq;
+    uint32_t              BestFreq = 0, BestC2Freq = 0;
+
+    Limit = (TargetFreq < CLKCFG_MAX_FREQUENCY_Hz) ? TargetFreq : CLKCFG_MAX_FREQUENCY_Hz;
+
+    for (C1Div = 1; C1Div <= 2; C1Div++) {
+        for (Mul = 1; Mul <= CLKCFG_PLL_MUL_MAX; Mul++) {
+            C2Freq = (SourceFreq / C1Div) * Mul;
+            for (Div = 1; (Div <= (1UL << CLKCFG_C3_DIV_SHIFT_MAX)) && (C2Freq <= CLKCFG_MAX_FREQUENCY_Hz); Div <<= 1) {
+                Freq = C2Freq / Div;
+                if ((Freq <= Limit) && (Freq != 0) &&
+                    ((Freq > BestFreq) || ((Freq == BestFreq) && (C2Freq < BestC2Freq)))) {
+                    BestFreq   = Freq;
+                    BestC2Freq = C2Freq;
+                }
+            }
+        }
+    }
+
+    Status = CLKCFG_Solve(&Config, Source, SourceFreq, TargetFreq);
+    if (BestFreq == 0) {
+        HOST_CHECK(Status == ERROR);
+        return;
+    }
+
+    HOST_CHECK(Status == SUCCESS);
+    if (Source == CLKCFG_SOURCE_HSE) {
+        HOST_CHECK((Config.CPU_C1Sel == RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSE) ||
+                   (Config.CPU_C1Sel == RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSE_DIV_2));
+    } else {
+        HOST_CHECK((Config.CPU_C1Sel == RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSI) ||
+                   (Config.CPU_C1Sel == RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSI_DIV_2));
+    }
+    HOST_CHECK((Config.PLLMul == 0) ||
+               ((Config.PLLMul >= CLKCFG_PLL_MUL_MIN) && (Config.PLLMul <= CLKCFG_PLL_MUL_MAX)));
+    HOST_CHECK((Config.CPU_C3Div != 0) && ((Config.CPU_C3Div & (Config.CPU_C3Div - 1)) == 0));
+    HOST_CHECK(Config.CPU_C3Div <= (1UL << CLKCFG_C3_DIV_SHIFT_MAX));
+    HOST_CHECK(C2Frequency(&Config, SourceFreq) <= CLKCFG_MAX_FREQUENCY_Hz);
+    HOST_CHECK(C2Frequency(&Config, SourceFreq) / Config.CPU_C3Div == Config.Frequency);
+    HOST_CHECK(Config.Frequency == BestFreq);
+    HOST_CHECK(C2Frequency(&Config, SourceFreq) == BestC2Freq);
+    HOST_CHECK(Config.FlashDelay == CLKCFG_GetFlashDelay(Config.Frequency));
+}
+
+int main(void)
+{
+    CLKCFG_Config_TypeDef Config;
+    uint32_t              Target;
+
+    /* Sweep of the targets up to above the limit for both generators. */
+    for (Target = 0; Target <= CLKCFG_MAX_FREQUENCY_Hz + 10000000; Target += 12345) {
+        CheckSolution(CLKCFG_SOURCE_HSE, HSE_Hz, Target);
+        CheckSolution(CLKCFG_SOURCE_HSI, HSI_MEASURED_Hz, Target);
+    }
+
+    /* HSE: 60 MHz is only reachable by HSE/2 * 15. */
+    HOST_CHECK(CLKCFG_Solve(&Config, CLKCFG_SOURCE_HSE, HSE_Hz, 100000000) == SUCCESS);
+    HOST_CHECK(Config.Frequency == CLKCFG_MAX_FREQUENCY_Hz);
+    HOST_CHECK(Config.CPU_C1Sel == RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSE_DIV_2);
+    HOST_CHECK((Config.PLLMul == 15) && (Config.CPU_C3Div == 1));
+
+    /* HSI measured below its nominal: HSI/2 * 15 is closer to the limit than HSI * 7. */
+    HOST_CHECK(CLKCFG_Solve(&Config, CLKCFG_SOURCE_HSI, HSI_MEASURED_Hz, 60000000) == SUCCESS);
+    HOST_CHECK(Config.Frequency == (HSI_MEASURED_Hz / 2) * 15);
+    HOST_CHECK(Config.CPU_C1Sel == RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSI_DIV_2);
+    HOST_CHECK((Config.PLLMul == 15) && (Config.CPU_C3Div == 1));
+
+    /* Tie: HSE / 2 and HSE bypassing the PLL and divided by 2 both give 4 MHz, the lower CPU_C2 wins. */
+    HOST_CHECK(CLKCFG_Solve(&Config, CLKCFG_SOURCE_HSE, HSE_Hz, 4000000) == SUCCESS);
+    HOST_CHECK(Config.CPU_C1Sel == RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSE_DIV_2);
+    HOST_CHECK((Config.PLLMul == 0) && (Config.CPU_C3Div == 1));
+
+    /* Tie: 16 MHz from CPU_C2 16 MHz or 32 MHz, the PLL runs at 16 MHz. */
+    HOST_CHECK(CLKCFG_Solve(&Config, CLKCFG_SOURCE_HSE, HSE_Hz, 16000000) == SUCCESS);
+    HOST_CHECK(C2Frequency(&Config, HSE_Hz) == 16000000);
+    HOST_CHECK(Config.CPU_C3Div == 1);
+
+    /* C3 divider: 3 MHz = HSE/2 * 3 / 4 (CPU_C2 12 MHz is the lowest). */
+    HOST_CHECK(CLKCFG_Solve(&Config, CLKCFG_SOURCE_HSE, HSE_Hz, 3000000) == SUCCESS);
+    HOST_CHECK(Config.Frequency == 3000000);
+    HOST_CHECK(Config.CPU_C1Sel == RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSE_DIV_2);
+    HOST_CHECK((Config.PLLMul == 3) && (Config.CPU_C3Div == 4));
+
+    /* Lowest reachable frequency: HSE/2 / 256, one hertz less is an error. */
+    HOST_CHECK(CLKCFG_Solve(&Config, CLKCFG_SOURCE_HSE, HSE_Hz, (HSE_Hz / 2) >> 8) == SUCCESS);
+    HOST_CHECK((Config.CPU_C3Div == 256) && (Config.Frequency == (HSE_Hz / 2) >> 8));
+    HOST_CHECK(CLKCFG_Solve(&Config, CLKCFG_SOURCE_HSE, HSE_Hz, ((HSE_Hz / 2) >> 8) - 1) == ERROR);
+    HOST_CHECK(CLKCFG_Solve(&Config, CLKCFG_SOURCE_HSI, HSI_MEASURED_Hz, 0) == ERROR);
+
+    /* FLASH wait states threshold. */
+    HOST_CHECK(CLKCFG_GetFlashDelay(CLKCFG_FLASH_DELAY_0_MAX_Hz) == FLASH_CMD_DELAY_CYCLE_0);
+    HOST_CHECK(CLKCFG_GetFlashDelay(CLKCFG_FLASH_DELAY_0_MAX_Hz + 1) == FLASH_CMD_DELAY_CYCLE_1);
+    HOST_CHECK(CLKCFG_Solve(&Config, CLKCFG_SOURCE_HSE, HSE_Hz, 30000000) == SUCCESS);
+    HOST_CHECK((Config.Frequency == 30000000) && (Config.FlashDelay == FLASH_CMD_DELAY_CYCLE_0));
+    HOST_CHECK(CLKCFG_Solve(&Config, CLKCFG_SOURCE_HSE, HSE_Hz, 32000000) == SUCCESS);
+    HOST_CHECK((Config.Frequency == 32000000) && (Config.FlashDelay == FLASH_CMD_DELAY_CYCLE_1));
+
+    /* SystemClockConfig: HSE is never ready, the HSI solution is applied. */
+    *(volatile uint32_t*)&HOST_RstClk.CLOCK_STATUS = RST_CLK_CLOCK_STATUS_PLL_CPU_RDY;
+    HOST_CHECK(SystemClockConfig(16000000) == SystemCoreClock);
+    HOST_CHECK(CoreClockUpdates == 1);
+    HOST_CHECK((HOST_RstClk.CPU_CLOCK & RST_CLK_CPU_CLOCK_HCLK_SEL_Msk) == RST_CLK_CPU_CLOCK_HCLK_SEL_CPU_C3);
+    HOST_CHECK(((HOST_RstClk.CPU_CLOCK & RST_CLK_CPU_CLOCK_CPU_C1_SEL_Msk) == RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSI) ||
+               ((HOST_RstClk.CPU_CLOCK & RST_CLK_CPU_CLOCK_CPU_C1_SEL_Msk) == RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSI_DIV_2));
+
+    return HOST_RESULT();
+}
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE test_clkcfg.c */
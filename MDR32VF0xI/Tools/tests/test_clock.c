@@ -0,0 +1,164 @@
+/**
+ *******************************************************************************
+ * @file    test_clock.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   Host test of the monotonic time (CLOCK) and the software timers
+ *          (SWTIMER) across the core clock changes of FREQ_SetFrequency.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+#define CLKTREE_STATIC     0
+#define CLOCK_USE_TIME_CSR 1
+#define SWTIMER_USE_MTIP   0
+#define CLKCFG_USE_HSE     0
+
+#include "system_MDR32VF0xI_config.h"
+#include "host.h"
+
+static MDR_RST_CLK_TypeDef HOST_RstClk;
+static MDR_FLASH_TypeDef   HOST_Flash;
+
+#undef MDR_RST_CLK
+#undef MDR_FLASH
+#define MDR_RST_CLK (&HOST_RstClk)
+#define MDR_FLASH   (&HOST_Flash)
+
+#include "system_MDR32VF0xI_clock.c"
+#include "system_MDR32VF0xI_pheap.c"
+#include "system_MDR32VF0xI_swtimer.c"
+#include "system_MDR32VF0xI_freq.c"
+
+uint32_t SystemCoreClock = 8000000;
+uint32_t SystemHSIClock  = 8000000;
+
+/* HCLK after CLKCFG_Apply, taken by SystemCoreClockUpdate. */
+static uint32_t AppliedFreq;
+static uint64_t CompareTime;
+static uint32_t Expired[2];
+
+void CLINT_MTIMER_SetCompareTime(uint64_t MTIMECMPValue)
+{
+    CompareTime = MTIMECMPValue;
+}
+
+ErrorStatus CLKCFG_Solve(CLKCFG_Config_TypeDef* Config, CLKCFG_Source_TypeDef Source,
+                         uint32_t SourceFreq, uint32_t TargetFreq)
+{
+    (void)Source;
+    (void)SourceFreq;
+
+    memset(Config, 0, sizeof(*Config));
+    Config->CPU_C1Sel = RST_CLK_CPU_CLOCK_CPU_C1_SEL_HSI;
+    Config->Frequency = TargetFreq;
+
+    return SUCCESS;
+}
+
+uint32_t CLKCFG_GetFlashDelay(uint32_t Frequency)
+{
+    (void)Frequency;
+    return 0;
+}
+
+ErrorStatus CLKCFG_Apply(const CLKCFG_Config_TypeDef* Config)
+{
+    AppliedFreq = Config->Frequency;
+    return SUCCESS;
+}
+
+/* CLOCK_USE_CORE_CLOCK_UPDATE is 0: FREQ calls CLOCK_Init itself. */
+void SystemCoreClockUpdate(void)
+{
+    SystemCoreClock = AppliedFreq;
+}
+
+static void SetTicks(uint64_t Ticks)
+{
+    HOST_Csr[CSR_TIME]  = (uint32_t)Ticks;
+    HOST_Csr[CSR_TIMEH] = (uint32_t)(Ticks >> 32);
+}
+
+static void TimerCallback(void* Context)
+{
+    Expired[(uintptr_t)Context]++;
+}
+
+int main(void)
+{
+    SWTIMER_TypeDef Periodic, Passed;
+    uint64_t        Ns;
+
+    /* 8 MHz, MTIME = HCLK / 2. */
+    HOST_RstClk.DIV_SYS_TIM = 1;
+    SetTicks(0);
+    CLOCK_Init();
+    HOST_CHECK(CLOCK_Calib.TickFreq == 4000000);
+
+    SWTIMER_Init();
+    SWTIMER_Create(&Periodic, TimerCallback, (void*)0);
+    SWTIMER_Create(&Passed, TimerCallback, (void*)1);
+
+    /* 0.5 s: a 1 ms periodic timer and a deadline already passed. */
+    SetTicks(2000000);
+    HOST_CHECK(CLOCK_GetNs() == 500000000ULL);
+    SWTIMER_Start(&Periodic, 4000, 4000);
+    SWTIMER_StartAt(&Passed, 1999000, 0);
+    HOST_CHECK(CompareTime == 1999000);
+
+    /* Upclock to 64 MHz: the time does not go backwards, the timers keep their time to expiration. */
+    HOST_CHECK(FREQ_SetFrequency(64000000) == 64000000);
+    HOST_CHECK(CLOCK_Calib.TickFreq == 32000000);
+    HOST_CHECK(CLOCK_GetNs() == 500000000ULL);
+    HOST_CHECK(Periodic.Node.Key == 2000000 + 32000);
+    HOST_CHECK(Periodic.Period == 32000);
+    HOST_CHECK(Passed.Node.Key == 1999000);
+    HOST_CHECK(CompareTime == 1999000);
+
+    SetTicks(2000000 + 32000);
+    HOST_CHECK(CLOCK_GetNs() == 501000000ULL);
+    SWTIMER_Process();
+    HOST_CHECK((Expired[0] == 1) && (Expired[1] == 1));
+    HOST_CHECK(Periodic.Node.Key == 2000000 + 64000);
+    HOST_CHECK(CompareTime == 2000000 + 64000);
+
+    /* Downclock to 2 MHz 0.25 ms before the next expiration. */
+    SetTicks(2000000 + 56000);
+    Ns = CLOCK_GetNs();
+    HOST_CHECK(Ns == 501750000ULL);
+    HOST_CHECK(FREQ_SetFrequency(2000000) == 2000000);
+    HOST_CHECK(CLOCK_GetNs() == Ns);
+    HOST_CHECK(Periodic.Node.Key == 2000000 + 56000 + 250);
+    HOST_CHECK(Periodic.Period == 1000);
+
+    SetTicks(2000000 + 56000 + 250);
+    HOST_CHECK(CLOCK_GetNs() == 502000000ULL);
+    SWTIMER_Process();
+    HOST_CHECK(Expired[0] == 2);
+    HOST_CHECK(CompareTime == 2000000 + 56000 + 250 + 1000);
+
+    /* A prescaler change is a recalibration too. */
+    HOST_RstClk.DIV_SYS_TIM = 0;
+    CLOCK_Init();
+    HOST_CHECK(CLOCK_GetNs() == 502000000ULL);
+    SetTicks(2000000 + 56000 + 250 + 2000);
+    HOST_CHECK(CLOCK_GetNs() == 503000000ULL);
+
+    return HOST_RESULT();
+}
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE test_clock.c */
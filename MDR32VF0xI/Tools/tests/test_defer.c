@@ -0,0 +1,196 @@
+/**
+ *******************************************************************************
+ * @file    test_defer.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   Host test of the deferred work (DEFER) software interrupt handler:
+ *          an interrupt is serviced during DEFER_Process, the trap CSRs are
+ *          restored and DEFER_Process is not re-entered.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+#define DEFER_USE_SWI 1
+
+#include "system_MDR32VF0xI_config.h"
+#include "host.h"
+#include "system_MDR32VF0xI_defer.c"
+
+#if defined(USE_MDR1206)
+#define SWI_HANDLER     CSIP_IRQHandler
+#define SWI_MCAUSE      (((uint_xlen_t)1 << (__riscv_xlen - 1)) | (0x1UL << 16) | CSIP_IRQn)
+#define DEVICE_MCAUSE   (((uint_xlen_t)1 << (__riscv_xlen - 1)) | (0x3UL << 16) | 20)
+#else
+#define SWI_HANDLER     MSIP_IRQHandler
+#define SWI_MCAUSE      (((uint_xlen_t)1 << (__riscv_xlen - 1)) | 3)
+#define DEVICE_MCAUSE   (((uint_xlen_t)1 << (__riscv_xlen - 1)) | 11)
+#endif
+
+/* Interrupted code MEPC. */
+#define THREAD_MEPC 0x10001000UL
+
+static DEFER_Queue_TypeDef Queue;
+static DEFER_Item_TypeDef  Buffer[8];
+
+/* Software interrupt requested by DEFER_Post. */
+static uint32_t SwiPending;
+/* Peripheral interrupt requested by the work. */
+static uint32_t DevicePending;
+static uint32_t DeviceServiced;
+static uint32_t SwiDepth, SwiReentered;
+static uint32_t Log[8], LogCount;
+
+#if defined(USE_MDR1206)
+void CLIC_StructInitIRQ(CLIC_IRQ_InitTypeDef* CLIC_IRQ_InitStruct)
+{
+    (void)CLIC_IRQ_InitStruct;
+}
+
+void CLIC_InitIRQ(IRQn_TypeDef IRQn, const CLIC_IRQ_InitTypeDef* CLIC_IRQ_InitStruct)
+{
+    (void)IRQn;
+    (void)CLIC_IRQ_InitStruct;
+}
+
+void CLIC_SetPendingIRQ(IRQn_TypeDef IRQn)
+{
+    (void)IRQn;
+    SwiPending = 1;
+}
+
+void CLIC_ClearPendingIRQ(IRQn_TypeDef IRQn)
+{
+    (void)IRQn;
+    SwiPending = 0;
+}
+#else
+void CLINT_SetSoftwareMachineIRQ(ITStatus IRQStatus)
+{
+    SwiPending = (IRQStatus == SET);
+}
+
+void PLIC_EnableSoftwareIRQ(PLIC_PrivilegeIRQ_TypeDef Privilege)
+{
+    (void)Privilege;
+    csr_set_bits(CSR_MIE, MIE_MSIE);
+}
+
+void PLIC_DisableSoftwareIRQ(PLIC_PrivilegeIRQ_TypeDef Privilege)
+{
+    (void)Privilege;
+    csr_clear_bits(CSR_MIE, MIE_MSIE);
+}
+#endif
+
+/* Take a trap as the core does, check that the handler restores the trap CSRs, return with MRET. */
+static void TakeTrap(IRQHandler_TypeDef Handler, uint_xlen_t MCause)
+{
+    uint_xlen_t MStatus;
+
+    HOST_Csr[CSR_MEPC]   = 0x10002000UL + MCause * 4;
+    HOST_Csr[CSR_MCAUSE] = MCause;
+    MStatus              = HOST_Csr[CSR_MSTATUS];
+    MStatus              = (MStatus & ~(CSR_MSTATUS_MIE | CSR_MSTATUS_MPIE)) | CSR_MSTATUS_MPP_Msk |
+              (((MStatus & CSR_MSTATUS_MIE) != 0) ? CSR_MSTATUS_MPIE : 0);
+    HOST_Csr[CSR_MSTATUS] = MStatus;
+
+    Handler();
+
+    HOST_CHECK(HOST_Csr[CSR_MEPC] == 0x10002000UL + MCause * 4);
+    HOST_CHECK(HOST_Csr[CSR_MCAUSE] == MCause);
+    HOST_CHECK(HOST_Csr[CSR_MSTATUS] == MStatus);
+
+    HOST_Csr[CSR_MSTATUS] = (MStatus & ~CSR_MSTATUS_MIE) | CSR_MSTATUS_MPIE |
+                            (((MStatus & CSR_MSTATUS_MPIE) != 0) ? CSR_MSTATUS_MIE : 0);
+}
+
+static void SwiHandler(void)
+{
+    SwiReentered |= (SwiDepth != 0);
+    SwiDepth++;
+    SWI_HANDLER();
+    SwiDepth--;
+}
+
+static void Work(void* Arg)
+{
+    Log[LogCount++] = (uint32_t)(uintptr_t)Arg;
+    if (Arg == (void*)1) {
+        DevicePending = 1;
+    }
+}
+
+static void DeviceHandler(void)
+{
+    DeviceServiced = 1;
+    /* Work posted by the preempting interrupt is executed by the same drain. */
+    DEFER_Post(&Queue, Work, (void*)3);
+}
+
+/* Interrupts are taken at the CSR accesses with MSTATUS.MIE set. */
+static void CsrHook(uint32_t Reg, HOST_CsrOp_TypeDef Op)
+{
+    (void)Reg;
+    (void)Op;
+
+    if ((HOST_Csr[CSR_MSTATUS] & CSR_MSTATUS_MIE) == 0) {
+        return;
+    }
+    if (DevicePending != 0) {
+        DevicePending = 0;
+        TakeTrap(DeviceHandler, DEVICE_MCAUSE);
+    }
+#if defined(USE_MDR32F02)
+    /* MSIP has no level, it is taken whenever MIE.MSIE is set. */
+    if ((SwiPending != 0) && ((HOST_Csr[CSR_MIE] & MIE_MSIE) != 0)) {
+        TakeTrap(SwiHandler, SWI_MCAUSE);
+    }
+#endif
+}
+
+int main(void)
+{
+    DEFER_Init();
+#if defined(USE_MDR32F02)
+    HOST_Csr[CSR_MIE] = MIE_MSIE;
+#endif
+    DEFER_InitQueue(&Queue, Buffer, 8, 0);
+
+    HOST_CHECK(DEFER_Post(&Queue, Work, (void*)1) == SUCCESS);
+    HOST_CHECK(DEFER_Post(&Queue, Work, (void*)2) == SUCCESS);
+    HOST_CHECK(SwiPending == 1);
+
+    /* Thread level with the interrupts enabled takes the software interrupt. */
+    HOST_Csr[CSR_MEPC]    = THREAD_MEPC;
+    HOST_Csr[CSR_MSTATUS] = CSR_MSTATUS_MIE;
+    HOST_CsrHook          = CsrHook;
+    TakeTrap(SwiHandler, SWI_MCAUSE);
+    HOST_CsrHook = NULL;
+
+    HOST_CHECK(DeviceServiced == 1);
+    HOST_CHECK(SwiReentered == 0);
+    HOST_CHECK(LogCount == 3);
+    HOST_CHECK((Log[0] == 1) && (Log[1] == 2) && (Log[2] == 3));
+    HOST_CHECK(DEFER_GetPending(&Queue) == 0);
+    HOST_CHECK((HOST_Csr[CSR_MSTATUS] & CSR_MSTATUS_MIE) != 0);
+#if defined(USE_MDR32F02)
+    HOST_CHECK((HOST_Csr[CSR_MIE] & MIE_MSIE) != 0);
+#endif
+
+    return HOST_RESULT();
+}
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE test_defer.c */
@@ -0,0 +1,114 @@
+/**
+ *******************************************************************************
+ * @file    test_funcprof.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   Host test of the function profiler (FUNCPROF): a block preserved
+ *          by a warm reset is not recorded into before FUNCPROF_Init,
+ *          the calls and the self cycles are recorded until FUNCPROF_Stop.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+#define USE_FUNCPROF         1
+#define FUNCPROF_NUM_ENTRIES 16
+#define FUNCPROF_STACK_DEPTH 4
+
+#include "system_MDR32VF0xI_config.h"
+#include "host.h"
+#include "system_MDR32VF0xI_funcprof.c"
+
+#define FUNC_OUTER ((void*)0x10000100UL)
+#define FUNC_INNER ((void*)0x10000200UL)
+
+/* MCYCLE advances by 10 cycles on every read. */
+static void CsrHook(uint32_t Reg, HOST_CsrOp_TypeDef Op)
+{
+    if ((Reg == CSR_MCYCLE) && (Op == HOST_CSR_READ)) {
+        HOST_Csr[CSR_MCYCLE] += 10;
+    }
+}
+
+static const FUNCPROF_Entry_TypeDef* FindEntry(void* Func)
+{
+    uint32_t Index;
+
+    for (Index = 0; Index < FUNCPROF_NUM_ENTRIES; Index++) {
+        if (FUNCPROF_Block.Entry[Index].Func == (uint32_t)(uintptr_t)Func) {
+            return &FUNCPROF_Block.Entry[Index];
+        }
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    const FUNCPROF_Entry_TypeDef* Outer;
+    const FUNCPROF_Entry_TypeDef* Inner;
+
+    HOST_CsrHook = CsrHook;
+
+    /* Block left running by the previous boot, the instrumented startup code runs before FUNCPROF_Init. */
+    memset(&FUNCPROF_Block, 0, sizeof(FUNCPROF_Block));
+    FUNCPROF_Block.Magic   = FUNCPROF_MAGIC;
+    FUNCPROF_Block.Running = 1;
+    FUNCPROF_Block.Calls   = 7;
+    FUNCPROF_Block.Depth   = 3;
+    __cyg_profile_func_enter(FUNC_OUTER, NULL);
+    __cyg_profile_func_exit(FUNC_OUTER, NULL);
+    __cyg_profile_func_exit(FUNC_OUTER, NULL);
+    HOST_CHECK(FUNCPROF_Block.Calls == 7);
+    HOST_CHECK(FUNCPROF_Block.Depth == 3);
+    HOST_CHECK(FindEntry(FUNC_OUTER) == NULL);
+
+    FUNCPROF_Init(8000000);
+    HOST_CHECK((FUNCPROF_Block.Calls == 0) && (FUNCPROF_Block.Depth == 0) && (FUNCPROF_Block.Running == 1));
+
+    /* The return of a call active at FUNCPROF_Init is ignored. */
+    __cyg_profile_func_exit(FUNC_OUTER, NULL);
+    HOST_CHECK(FUNCPROF_Block.Depth == 0);
+
+    __cyg_profile_func_enter(FUNC_OUTER, NULL);
+    __cyg_profile_func_enter(FUNC_INNER, NULL);
+    __cyg_profile_func_exit(FUNC_INNER, NULL);
+    __cyg_profile_func_enter(FUNC_INNER, NULL);
+    __cyg_profile_func_exit(FUNC_INNER, NULL);
+    __cyg_profile_func_exit(FUNC_OUTER, NULL);
+
+    Outer = FindEntry(FUNC_OUTER);
+    Inner = FindEntry(FUNC_INNER);
+    HOST_CHECK((Outer != NULL) && (Inner != NULL));
+    if ((Outer != NULL) && (Inner != NULL)) {
+        HOST_CHECK(Outer->Calls == 1);
+        HOST_CHECK(Inner->Calls == 2);
+        /* Inner: EnterCycles to ExitCycles is one read apart. */
+        HOST_CHECK(Inner->SelfCycles == 2 * 10);
+        /* Outer: three reads apart around the calls, the hooks of its callees excluded. */
+        HOST_CHECK(Outer->SelfCycles == 3 * 10);
+    }
+    HOST_CHECK(FUNCPROF_Block.Calls == 3);
+    HOST_CHECK(FUNCPROF_Block.Depth == 0);
+
+    FUNCPROF_Stop();
+    __cyg_profile_func_enter(FUNC_OUTER, NULL);
+    HOST_CHECK(FUNCPROF_Block.Calls == 3);
+    HOST_CHECK(FUNCPROF_Block.Running == 0);
+
+    return HOST_RESULT();
+}
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE test_funcprof.c */
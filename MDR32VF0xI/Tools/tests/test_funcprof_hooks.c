@@ -0,0 +1,65 @@
+/**
+ *******************************************************************************
+ * @file    test_funcprof_hooks.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   Host test of the function profiler (FUNCPROF) built with the same
+ *          flags as the application: the hooks do not call themselves.
+ *          HOST_CFLAGS: -O2 -finstrument-functions
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+#define USE_FUNCPROF         1
+#define FUNCPROF_NUM_ENTRIES 16
+#define FUNCPROF_STACK_DEPTH 4
+
+#include "system_MDR32VF0xI_config.h"
+#include "host.h"
+#include "system_MDR32VF0xI_funcprof.c"
+
+#define NUM_CALLS 5
+
+static volatile uint32_t Counter;
+
+__attribute__((noinline)) static void Work(void)
+{
+    Counter++;
+}
+
+int main(void)
+{
+    uint32_t Index;
+
+    memset(&FUNCPROF_Block, 0, sizeof(FUNCPROF_Block));
+    FUNCPROF_Init(8000000);
+
+    for (Index = 0; Index < NUM_CALLS; Index++) {
+        Work();
+    }
+
+    FUNCPROF_Stop();
+
+    /* Only the calls of Work are recorded, the hooks and the inlined helpers are not instrumented. */
+    HOST_CHECK(FUNCPROF_Block.Calls == NUM_CALLS);
+    HOST_CHECK(FUNCPROF_Block.Dropped == 0);
+    HOST_CHECK(FUNCPROF_Block.Overflows == 0);
+    HOST_CHECK(Counter == NUM_CALLS);
+
+    return HOST_RESULT();
+}
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE test_funcprof_hooks.c */
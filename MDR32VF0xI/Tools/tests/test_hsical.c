@@ -0,0 +1,169 @@
+/**
+ *******************************************************************************
+ * @file    test_hsical.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   Host test of the HSI calibration (HSICAL): the measurement is refused
+ *          while the RTC is enabled, the BKP write protection of the caller
+ *          and HSE are restored, CLOCK and SWTIMER follow the switch to HSI.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+#define CLKTREE_STATIC     0
+#define CLOCK_USE_TIME_CSR 1
+#define SWTIMER_USE_MTIP   0
+
+#include "system_MDR32VF0xI_config.h"
+#include "host.h"
+
+static MDR_BKP_TypeDef     HOST_Bkp;
+static MDR_RST_CLK_TypeDef HOST_RstClk;
+
+#undef MDR_BKP
+#undef MDR_RST_CLK
+#define MDR_BKP     (&HOST_Bkp)
+#define MDR_RST_CLK (&HOST_RstClk)
+
+#if defined(USE_MDR32F02)
+static OTP_SpecialFields_TypeDef HOST_Otp;
+
+#undef OTP_SPECIAL_FIELDS
+#define OTP_SPECIAL_FIELDS (&HOST_Otp)
+#endif
+
+#include "system_MDR32VF0xI_hsical.c"
+#include "system_MDR32VF0xI_clock.c"
+#include "system_MDR32VF0xI_pheap.c"
+#include "system_MDR32VF0xI_swtimer.c"
+
+#define WPR_KEY    HSICAL_BKP_WPR_KEY
+#define RTC_CR_RUN (BKP_RTC_CR_RTC_EN_Msk | BKP_RTC_CR_RTC_SEL_LSE)
+
+uint32_t SystemCoreClock = 8000000;
+uint32_t SystemHSIClock  = 8000000;
+
+static uint32_t ClockUpdates;
+static uint32_t HSITimeReads;
+
+void SystemCoreClockUpdate(void)
+{
+    ClockUpdates++;
+}
+
+void CLINT_MTIMER_SetCompareTime(uint64_t MTIMECMPValue)
+{
+    (void)MTIMECMPValue;
+}
+
+/* MTIME advances by 1 ms of the HSI clock (4000 ticks at 8 MHz / 2) on every read while HCLK is HSI. */
+static void CsrHook(uint32_t Reg, HOST_CsrOp_TypeDef Op)
+{
+    if ((Reg == CSR_TIME) && (Op == HOST_CSR_READ) &&
+        ((HOST_RstClk.CPU_CLOCK & RST_CLK_CPU_CLOCK_HCLK_SEL_Msk) == RST_CLK_CPU_CLOCK_HCLK_SEL_HSI)) {
+        HOST_Csr[CSR_TIME] += 4000;
+        HSITimeReads++;
+    }
+}
+
+static void TimerCallback(void* Context)
+{
+    (void)Context;
+}
+
+int main(void)
+{
+    SWTIMER_TypeDef Timer;
+    uint64_t        Ns;
+    uint32_t        Trim;
+
+    HOST_Bkp.CLK = BKP_CLK_LSE_RDY;
+
+    /* HSICAL_SetTrim keeps the write protection of the caller. */
+    HOST_Bkp.WPR = 0;
+    HSICAL_SetTrim(5);
+    HOST_CHECK(HSICAL_GetTrim() == 5);
+    HOST_CHECK(HOST_Bkp.WPR == 0);
+    HOST_Bkp.WPR = WPR_KEY;
+    HSICAL_SetTrim(HSICAL_TRIM_MAX);
+    HOST_CHECK(HSICAL_GetTrim() == HSICAL_TRIM_MAX);
+    HOST_CHECK(HOST_Bkp.WPR == WPR_KEY);
+
+    /* Running RTC: nothing is touched. */
+    HSICAL_SetTrim(5);
+    HOST_Bkp.WPR     = 0;
+    HOST_Bkp.RTC_CR  = RTC_CR_RUN;
+    HOST_Bkp.RTC_PRL = 32767;
+    HOST_CHECK(HSICAL_Measure(HSICAL_REF_LSE, 64) == 0);
+    HOST_CHECK(HOST_Bkp.RTC_CR == RTC_CR_RUN);
+    HOST_CHECK(HOST_Bkp.RTC_PRL == 32767);
+    HOST_CHECK(HOST_Bkp.WPR == 0);
+
+#if defined(USE_MDR32F02)
+    /* The factory trim is not left loaded on an error. */
+    memset(&HOST_Otp, 0xFF, sizeof(HOST_Otp));
+    *(uint32_t*)&HOST_Otp.HSI_TRIM = 20;
+#endif
+    HOST_CHECK(HSICAL_Calibrate(HSICAL_REF_LSE, 64) == ERROR);
+    HOST_CHECK(HSICAL_GetTrim() == 5);
+    HOST_CHECK(HOST_Bkp.WPR == 0);
+    HOST_CHECK(ClockUpdates == 0);
+    HOST_CHECK(SystemHSIClock == 8000000);
+
+    /* Stopped RTC: the registers and the write protection are restored,
+       the prescaler counter does not run on the host, so the measurement times out. */
+    HOST_Bkp.RTC_CR  = BKP_RTC_CR_RTC_SEL_LSE;
+    HOST_Bkp.RTC_PRL = 100;
+    for (Trim = 0; Trim < 2; Trim++) {
+        HOST_Bkp.WPR = (Trim == 0) ? 0 : WPR_KEY;
+        HOST_CHECK(HSICAL_Measure(HSICAL_REF_LSE, 64) == 0);
+        HOST_CHECK(HOST_Bkp.RTC_CR == BKP_RTC_CR_RTC_SEL_LSE);
+        HOST_CHECK(HOST_Bkp.RTC_PRL == 100);
+        HOST_CHECK(HOST_Bkp.WPR == ((Trim == 0) ? 0 : WPR_KEY));
+    }
+
+    /* HSE started for the measurement (HSE_RDY is not set on the host) is stopped again. */
+    HOST_RstClk.HS_CONTROL = 0;
+    HOST_CHECK(HSICAL_Measure(HSICAL_REF_HSE, 64) == 0);
+    HOST_CHECK(HOST_RstClk.HS_CONTROL == 0);
+
+    /* HCLK 64 MHz from CPU_C3, MTIME = HCLK / 2 with a 100 ms periodic timer. */
+    HOST_Csr[CSR_TIME]      = 32000000;
+    HOST_RstClk.CPU_CLOCK   = RST_CLK_CPU_CLOCK_HCLK_SEL_CPU_C3;
+    HOST_RstClk.DIV_SYS_TIM = 1;
+    SystemCoreClock         = 64000000;
+    CLOCK_Init();
+    Ns = CLOCK_GetNs();
+    SWTIMER_Init();
+    SWTIMER_Create(&Timer, TimerCallback, NULL);
+    SWTIMER_Start(&Timer, 3200000, 3200000);
+
+    /* The time on HSI is counted at the HSI rate, the clock and the timer are restored. */
+    HOST_CsrHook = CsrHook;
+    HOST_CHECK(HSICAL_Measure(HSICAL_REF_LSE, 64) == 0);
+    HOST_CsrHook = NULL;
+    HOST_CHECK(HSITimeReads != 0);
+    HOST_CHECK(CLOCK_GetNs() == Ns + (uint64_t)HSITimeReads * 1000000);
+    HOST_CHECK(SystemCoreClock == 64000000);
+    HOST_CHECK(CLOCK_Calib.TickFreq == 32000000);
+    /* 100 ms less the time on HSI is left to the expiration. */
+    HOST_CHECK(Timer.Period == 3200000);
+    HOST_CHECK(Timer.Node.Key == HOST_Csr[CSR_TIME] + 3200000 - (uint64_t)HSITimeReads * 32000);
+
+    return HOST_RESULT();
+}
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE test_hsical.c */
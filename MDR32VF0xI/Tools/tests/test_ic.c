@@ -0,0 +1,80 @@
+/**
+ *******************************************************************************
+ * @file    test_ic.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   Host test of the interrupt controller API (IC): the priority
+ *          encoding and IC_PRIORITY_OFF switching the interrupt off.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+#include "host_plic.h"
+#include "system_MDR32VF0xI_config.h"
+#include "host.h"
+
+#if defined(USE_MDR1206)
+static CLIC_TypeDef HOST_Clic;
+
+#undef CLIC
+#define CLIC (&HOST_Clic)
+#endif
+
+#include "system_MDR32VF0xI_ic.h"
+#include "system_MDR32VF0xI_ic.c"
+
+#define TEST_IRQ ((IRQn_TypeDef)3)
+
+int main(void)
+{
+#if defined(USE_MDR1206)
+    IC_SetPriorityIRQ(TEST_IRQ, IC_PRIORITY_HIGHEST);
+    IC_EnableIRQ(TEST_IRQ);
+    HOST_CHECK(HOST_Clic.INT[TEST_IRQ].CTL == 0xFF);
+    HOST_CHECK(HOST_Clic.INT[TEST_IRQ].IE == 1);
+
+    /* CTL 0x1F is a non-zero CLIC level, the interrupt enable bit is cleared. */
+    IC_SetPriorityIRQ(TEST_IRQ, IC_PRIORITY_OFF);
+    HOST_CHECK(HOST_Clic.INT[TEST_IRQ].IE == 0);
+
+    IC_SetPriorityIRQ(TEST_IRQ, IC_PRIORITY_LOWEST);
+    HOST_CHECK(HOST_Clic.INT[TEST_IRQ].CTL == 0x3F);
+    HOST_CHECK(HOST_Clic.INT[TEST_IRQ].IE == 0);
+    IC_EnableIRQ(TEST_IRQ);
+    HOST_CHECK(HOST_Clic.INT[TEST_IRQ].IE == 1);
+
+    IC_SetThreshold(IC_PRIORITY_OFF);
+    HOST_CHECK(HOST_Csr[CSR_MINTTHRESH] == 0);
+#elif defined(USE_MDR32F02)
+    /* PLIC priority 0 never interrupts, the source stays enabled. */
+    IC_SetPriorityIRQ(TEST_IRQ, IC_PRIORITY_HIGHEST);
+    IC_EnableIRQ(TEST_IRQ);
+    HOST_CHECK(HOST_Plic.Priority[TEST_IRQ + 1] == IC_PRIORITY_HIGHEST);
+    HOST_CHECK(IC_GetPendingIRQ(TEST_IRQ) == RESET);
+
+    IC_SetPriorityIRQ(TEST_IRQ, IC_PRIORITY_OFF);
+    HOST_PlicRaise(TEST_IRQ + 1);
+    HOST_CHECK(IC_GetPendingIRQ(TEST_IRQ) == SET);
+    HOST_CHECK(HOST_PlicClaim() == 0);
+
+    IC_SetPriorityIRQ(TEST_IRQ, IC_PRIORITY_LOWEST);
+    HOST_CHECK(HOST_PlicClaim() == TEST_IRQ + 1);
+#endif
+
+    return HOST_RESULT();
+}
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE test_ic.c */
@@ -0,0 +1,205 @@
+/**
+ *******************************************************************************
+ * @file    test_misalign.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   Host test of the misaligned access emulation (MISALIGN): decoding of
+ *          LB/LH/LHU/LW, SH/SW and C.LW/C.SW/C.LWSP/C.SWSP, emulation on
+ *          a misaligned buffer.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+#define IT_USE_MISALIGN_EMU 1
+
+#include "system_MDR32VF0xI_config.h"
+#include "host.h"
+#include "system_MDR32VF0xI_misalign.c"
+
+/* Registers. */
+#define X_RA 1
+#define X_SP 2
+#define X_T0 5
+#define X_T1 6
+#define X_T2 7
+#define X_S0 8
+#define X_S1 9
+#define X_A0 10
+#define X_A1 11
+#define X_A2 12
+#define X_A3 13
+#define X_A4 14
+#define X_A5 15
+#define X_S2 18
+
+/* MCAUSE of the load and store address misaligned exceptions with CLIC MPP, MPIE and MPIL set. */
+#define MCAUSE_LOAD  0x38FF0004UL
+#define MCAUSE_STORE 0x38FF0006UL
+
+static uint32_t TrapCount;
+
+static void TrapHandler(void)
+{
+    TrapCount++;
+}
+
+IRQHandler_TypeDef ExceptionVectorTable[16] = {
+    TrapHandler, TrapHandler, TrapHandler, TrapHandler, TrapHandler, TrapHandler, TrapHandler, TrapHandler,
+    TrapHandler, TrapHandler, TrapHandler, TrapHandler, TrapHandler, TrapHandler, TrapHandler, TrapHandler
+};
+
+static void CheckDecode(uint32_t Instr, MISALIGN_Access_TypeDef Access, uint8_t Size, uint8_t SignExtend,
+                        uint8_t Reg, uint8_t BaseReg, uint8_t Length, int32_t Offset)
+{
+    MISALIGN_Instr_TypeDef Decoded;
+
+    memset(&Decoded, 0xA5, sizeof(Decoded));
+    HOST_CHECK(MISALIGN_Decode(Instr, &Decoded) == SUCCESS);
+    HOST_CHECK(Decoded.Access == Access);
+    HOST_CHECK(Decoded.Size == Size);
+    HOST_CHECK(Decoded.SignExtend == SignExtend);
+    HOST_CHECK(Decoded.Reg == Reg);
+    HOST_CHECK(Decoded.BaseReg == BaseReg);
+    HOST_CHECK(Decoded.Length == Length);
+    HOST_CHECK(Decoded.Offset == Offset);
+}
+
+static void TestDecode(void)
+{
+    MISALIGN_Instr_TypeDef Decoded;
+
+    /* lh t0, 3(a0) */
+    CheckDecode(0x00351283UL, MISALIGN_ACCESS_LOAD, 2, 1, X_T0, X_A0, 4, 3);
+    /* lhu t1, -5(a1) */
+    CheckDecode(0xFFB5D303UL, MISALIGN_ACCESS_LOAD, 2, 0, X_T1, X_A1, 4, -5);
+    /* lw s1, 2047(a2) */
+    CheckDecode(0x7FF62483UL, MISALIGN_ACCESS_LOAD, 4, 1, X_S1, X_A2, 4, 2047);
+    /* lb a3, -1(a4) */
+    CheckDecode(0xFFF70683UL, MISALIGN_ACCESS_LOAD, 1, 1, X_A3, X_A4, 4, -1);
+    /* sh t2, 7(a0) */
+    CheckDecode(0x007513A3UL, MISALIGN_ACCESS_STORE, 2, 0, X_T2, X_A0, 4, 7);
+    /* sw s2, -2048(a1) */
+    CheckDecode(0x8125A023UL, MISALIGN_ACCESS_STORE, 4, 0, X_S2, X_A1, 4, -2048);
+    /* c.lw a2, 124(a3) */
+    CheckDecode(0x5EF0UL, MISALIGN_ACCESS_LOAD, 4, 1, X_A2, X_A3, 2, 124);
+    /* c.sw a4, 68(a5) */
+    CheckDecode(0xC3F8UL, MISALIGN_ACCESS_STORE, 4, 0, X_A4, X_A5, 2, 68);
+    /* c.lwsp ra, 252(sp) */
+    CheckDecode(0x50FEUL, MISALIGN_ACCESS_LOAD, 4, 1, X_RA, X_SP, 2, 252);
+    /* c.swsp s0, 132(sp) */
+    CheckDecode(0xC322UL, MISALIGN_ACCESS_STORE, 4, 0, X_S0, X_SP, 2, 132);
+
+    /* add a0, a1, a2 */
+    HOST_CHECK(MISALIGN_Decode(0x00C58533UL, &Decoded) == ERROR);
+    /* ld a0, 0(a1) (RV64) */
+    HOST_CHECK(MISALIGN_Decode(0x0005B503UL, &Decoded) == ERROR);
+}
+
+/* Place an instruction at Code, return the MEPC of it. */
+static uint_xlen_t PutInstr(uint16_t* Code, uint32_t Instr)
+{
+    Code[0] = (uint16_t)Instr;
+    Code[1] = (uint16_t)(Instr >> 16);
+    return (uint_xlen_t)Code;
+}
+
+static void TestEmulate(void)
+{
+    uint16_t                      Code[2];
+    uint8_t                       Data[32];
+    uint_xlen_t                   Regs[32];
+    uint_xlen_t                   MEpc;
+    uint8_t*                      Base = (uint8_t*)(((uintptr_t)Data + 3) & ~(uintptr_t)3);
+    const MISALIGN_Stats_TypeDef* Stats;
+
+    MISALIGN_ResetStats();
+    TrapCount = 0;
+    memset(Regs, 0, sizeof(Regs));
+
+    /* lh t0, 3(a0): sign-extended. */
+    memcpy(Base, "\x00\x11\x22\x80\xFF\x33\x44\x55\x66\x77\x88\x99", 12);
+    Regs[X_A0] = (uint_xlen_t)Base;
+    MEpc       = PutInstr(Code, 0x00351283UL);
+    HOST_CHECK(MISALIGN_Emulate(Regs, MEpc, MCAUSE_LOAD) == MEpc + 4);
+    HOST_CHECK((uint32_t)Regs[X_T0] == 0xFFFFFF80UL);
+
+    /* lhu t1, -5(a1): zero-extended. */
+    Regs[X_A1] = (uint_xlen_t)(Base + 8);
+    HOST_CHECK(MISALIGN_Emulate(Regs, PutInstr(Code, 0xFFB5D303UL), MCAUSE_LOAD) == MEpc + 4);
+    HOST_CHECK((uint32_t)Regs[X_T1] == 0x0000FF80UL);
+
+    /* c.lw a2, 124(a3) */
+    Regs[X_A3] = (uint_xlen_t)(Base + 1 - 124);
+    HOST_CHECK(MISALIGN_Emulate(Regs, PutInstr(Code, 0x5EF0UL), MCAUSE_LOAD) == MEpc + 2);
+    HOST_CHECK((uint32_t)Regs[X_A2] == 0xFF802211UL);
+
+    /* c.lwsp ra, 252(sp) */
+    Regs[X_SP] = (uint_xlen_t)(Base + 5 - 252);
+    HOST_CHECK(MISALIGN_Emulate(Regs, PutInstr(Code, 0x50FEUL), MCAUSE_LOAD) == MEpc + 2);
+    HOST_CHECK((uint32_t)Regs[X_RA] == 0x66554433UL);
+
+    /* sh t2, 7(a0) */
+    Regs[X_T2] = 0xDEADBEEFUL;
+    HOST_CHECK(MISALIGN_Emulate(Regs, PutInstr(Code, 0x007513A3UL), MCAUSE_STORE) == MEpc + 4);
+    HOST_CHECK((Base[6] == 0x44) && (Base[7] == 0xEF) && (Base[8] == 0xBE) && (Base[9] == 0x77));
+
+    /* sw s2, -2048(a1) */
+    Regs[X_A1] = (uint_xlen_t)(Base + 2049);
+    Regs[X_S2] = 0x01020304UL;
+    HOST_CHECK(MISALIGN_Emulate(Regs, PutInstr(Code, 0x8125A023UL), MCAUSE_STORE) == MEpc + 4);
+    HOST_CHECK(memcmp(Base, "\x00\x04\x03\x02\x01\x33", 6) == 0);
+
+    /* c.sw a4, 68(a5) */
+    Regs[X_A5] = (uint_xlen_t)(Base + 3 - 68);
+    Regs[X_A4] = 0xA1B2C3D4UL;
+    HOST_CHECK(MISALIGN_Emulate(Regs, PutInstr(Code, 0xC3F8UL), MCAUSE_STORE) == MEpc + 2);
+    HOST_CHECK(memcmp(Base + 2, "\x03\xD4\xC3\xB2\xA1\xEF", 6) == 0);
+
+    /* c.swsp s0, 132(sp) */
+    Regs[X_SP] = (uint_xlen_t)(Base + 10 - 132);
+    Regs[X_S0] = 0x11223344UL;
+    HOST_CHECK(MISALIGN_Emulate(Regs, PutInstr(Code, 0xC322UL), MCAUSE_STORE) == MEpc + 2);
+    HOST_CHECK(memcmp(Base + 9, "\x77\x44\x33\x22\x11", 5) == 0);
+
+    HOST_CHECK(TrapCount == 0);
+
+    /* A load reported as a store, a load into SP and not a load/store go to the handlers. */
+    Regs[X_A0] = (uint_xlen_t)Base;
+    HOST_CHECK(MISALIGN_Emulate(Regs, PutInstr(Code, 0x00351283UL), MCAUSE_STORE) == MEpc);
+    HOST_CHECK(MISALIGN_Emulate(Regs, PutInstr(Code, 0x4112UL), MCAUSE_LOAD) == MEpc);
+    HOST_CHECK(MISALIGN_Emulate(Regs, PutInstr(Code, 0x00C58533UL), MCAUSE_LOAD) == MEpc);
+    HOST_CHECK(TrapCount == 3);
+
+    Stats = MISALIGN_GetStats();
+    HOST_CHECK(Stats->Loads == 4);
+    HOST_CHECK(Stats->Stores == 4);
+    HOST_CHECK(Stats->Unsupported == 3);
+    HOST_CHECK(Stats->PC[0].PC == MEpc);
+    HOST_CHECK(Stats->PC[0].Count == 8);
+
+    MISALIGN_ResetStats();
+    HOST_CHECK((Stats->Loads == 0) && (Stats->Stores == 0) && (Stats->Unsupported == 0) && (Stats->PC[0].Count == 0));
+}
+
+int main(void)
+{
+    TestDecode();
+    TestEmulate();
+
+    return HOST_RESULT();
+}
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE test_misalign.c */
@@ -0,0 +1,220 @@
+/**
+ *******************************************************************************
+ * @file    test_pheap.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   Host test of the pairing heap (PHEAP): the insert/pop order over
+ *          many keys, the removal of the root, a leaf and an inner node,
+ *          the duplicate keys and random operations against a reference.
+ *          The heap structure (order, links, size) is checked after
+ *          the operations.
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+#include "system_MDR32VF0xI_config.h"
+#include "host.h"
+#include "system_MDR32VF0xI_pheap.c"
+
+#define NUM_NODES 1000
+
+static PHEAP_TypeDef      Heap;
+static PHEAP_Node_TypeDef Nodes[NUM_NODES];
+static uint8_t            InHeap[NUM_NODES];
+static uint8_t            Seen[NUM_NODES];
+static uint32_t           Seed = 36;
+
+static uint32_t Random(void)
+{
+    Seed = Seed * 1664525UL + 1013904223UL;
+    return Seed >> 8;
+}
+
+/* Check the heap order and the links of a subtree, return the number of its nodes. */
+static uint32_t CheckSubtree(const PHEAP_Node_TypeDef* Node)
+{
+    const PHEAP_Node_TypeDef* Child;
+    const PHEAP_Node_TypeDef* Prev  = Node;
+    uint32_t                  Count = 1;
+
+    HOST_CHECK(InHeap[Node - Nodes] == 1);
+    HOST_CHECK(Seen[Node - Nodes] == 0);
+    Seen[Node - Nodes] = 1;
+
+    for (Child = Node->Child; Child != NULL; Child = Child->Next) {
+        HOST_CHECK(Child->Key >= Node->Key);
+        HOST_CHECK(Child->Prev == Prev);
+        Prev = Child;
+        Count += CheckSubtree(Child);
+    }
+
+    return Count;
+}
+
+/* Check the whole heap holds exactly the nodes marked in InHeap. */
+static void CheckHeap(void)
+{
+    uint32_t Index, Expected = 0;
+
+    memset(Seen, 0, sizeof(Seen));
+    for (Index = 0; Index < NUM_NODES; Index++) {
+        Expected += InHeap[Index];
+    }
+
+    if (Heap.Root == NULL) {
+        HOST_CHECK(Expected == 0);
+        return;
+    }
+    HOST_CHECK(Heap.Root->Prev == NULL);
+    HOST_CHECK(Heap.Root->Next == NULL);
+    HOST_CHECK(CheckSubtree(Heap.Root) == Expected);
+}
+
+static void Insert(uint32_t Index, uint64_t Key)
+{
+    Nodes[Index].Key = Key;
+    PHEAP_Insert(&Heap, &Nodes[Index]);
+    InHeap[Index] = 1;
+}
+
+static void Remove(uint32_t Index)
+{
+    PHEAP_Remove(&Heap, &Nodes[Index]);
+    InHeap[Index] = 0;
+    HOST_CHECK((Nodes[Index].Child == NULL) && (Nodes[Index].Next == NULL) && (Nodes[Index].Prev == NULL));
+}
+
+/* Pop all the nodes, check the keys do not decrease and each node is returned once. */
+static void PopAll(void)
+{
+    PHEAP_Node_TypeDef* Node;
+    uint64_t            LastKey = 0;
+
+    while ((Node = PHEAP_PopMin(&Heap)) != NULL) {
+        HOST_CHECK(Node->Key >= LastKey);
+        HOST_CHECK(InHeap[Node - Nodes] == 1);
+        LastKey              = Node->Key;
+        InHeap[Node - Nodes] = 0;
+    }
+    CheckHeap();
+}
+
+/* Smallest key of the nodes in the heap. */
+static uint64_t MinKey(void)
+{
+    uint32_t Index;
+    uint64_t Key = UINT64_MAX;
+
+    for (Index = 0; Index < NUM_NODES; Index++) {
+        if ((InHeap[Index] == 1) && (Nodes[Index].Key < Key)) {
+            Key = Nodes[Index].Key;
+        }
+    }
+
+    return Key;
+}
+
+/* Index of a node in the heap other than the root, with or without children. */
+static uint32_t FindNode(uint32_t WithChildren)
+{
+    uint32_t Index;
+
+    for (Index = 0; Index < NUM_NODES; Index++) {
+        if ((InHeap[Index] == 1) && (&Nodes[Index] != Heap.Root) &&
+            ((Nodes[Index].Child != NULL) == (WithChildren != 0))) {
+            return Index;
+        }
+    }
+
+    return NUM_NODES;
+}
+
+int main(void)
+{
+    PHEAP_Node_TypeDef* Node;
+    uint64_t            Key;
+    uint32_t            Index, Step;
+
+    /* Empty heap. */
+    PHEAP_Init(&Heap);
+    HOST_CHECK(PHEAP_GetMin(&Heap) == NULL);
+    HOST_CHECK(PHEAP_PopMin(&Heap) == NULL);
+
+    /* Insert/pop order over many keys, above 32 bits too. */
+    for (Index = 0; Index < NUM_NODES; Index++) {
+        Insert(Index, ((uint64_t)Random() << 24) ^ Random());
+        HOST_CHECK(PHEAP_GetMin(&Heap)->Key == MinKey());
+    }
+    CheckHeap();
+    PopAll();
+
+    /* Removal of the root, a leaf and an inner node of a heap restructured by a pop. */
+    Insert(0, 0);
+    for (Index = 1; Index < NUM_NODES; Index++) {
+        Insert(Index, 1 + (Random() % 5000));
+    }
+    HOST_CHECK(PHEAP_PopMin(&Heap) == &Nodes[0]);
+    InHeap[0] = 0;
+    CheckHeap();
+
+    Index = (uint32_t)(Heap.Root - Nodes);
+    Remove(Index);
+    CheckHeap();
+    HOST_CHECK(Heap.Root->Key == MinKey());
+
+    Index = FindNode(0);
+    HOST_CHECK(Index < NUM_NODES);
+    Remove(Index);
+    CheckHeap();
+
+    Index = FindNode(1);
+    HOST_CHECK(Index < NUM_NODES);
+    Remove(Index);
+    CheckHeap();
+    HOST_CHECK(Heap.Root->Key == MinKey());
+    PopAll();
+
+    /* Duplicate keys: every node is returned once. */
+    for (Index = 0; Index < NUM_NODES; Index++) {
+        Insert(Index, 7 + (Index % 3));
+    }
+    Remove(NUM_NODES / 2);
+    CheckHeap();
+    PopAll();
+
+    /* Random inserts, removals and pops against the reference minimum. */
+    for (Step = 0; Step < 20000; Step++) {
+        Index = Random() % NUM_NODES;
+        if (InHeap[Index] == 0) {
+            Insert(Index, Random() % 100);
+        } else if ((Random() % 2) == 0) {
+            Remove(Index);
+        } else {
+            Key  = MinKey();
+            Node = PHEAP_PopMin(&Heap);
+            HOST_CHECK(Node->Key == Key);
+            InHeap[Node - Nodes] = 0;
+        }
+        if ((Step % 1000) == 0) {
+            CheckHeap();
+        }
+    }
+    PopAll();
+
+    return HOST_RESULT();
+}
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE test_pheap.c */
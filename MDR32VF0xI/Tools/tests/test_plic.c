@@ -0,0 +1,258 @@
+/**
+ *******************************************************************************
+ * @file    test_plic.c
+ * @author  Milandr Application Team
+ * @version V0.1.0
+ * @date    19/10/2026
+ * @brief   Host test of the PLIC external interrupt dispatch (MDR32F02):
+ *          PLIC_DispatchIRQ with several pending sources including the DMA
+ *          source (ID 1), one completion per claim, and the nested dispatch
+ *          of IT_TrapDispatch (IT_PLIC_NESTED) restoring the threshold and
+ *          the trap CSRs after a preemption, with a handler registered
+ *          with context (IT_USE_HANDLER_TABLE).
+ *******************************************************************************
+ * <br><br>
+ *
+ * THE PRESENT FIRMWARE IS FOR GUIDANCE ONLY. IT AIMS AT PROVIDING CUSTOMERS
+ * WITH CODING INFORMATION REGARDING MILANDR'S PRODUCTS IN ORDER TO FACILITATE
+ * THE USE AND SAVE TIME. MILANDR SHALL NOT BE HELD LIABLE FOR ANY
+ * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES RESULTING
+ * FROM THE CONTENT OF SUCH FIRMWARE AND/OR A USE MADE BY CUSTOMERS OF THE
+ * CODING INFORMATION CONTAINED HEREIN IN THEIR PRODUCTS.
+ *
+ * <h2><center>&copy; COPYRIGHT {YYYY} Milandr</center></h2>
+ *******************************************************************************
+ */
+
+#define IT_PLIC_NESTED       1
+#define IT_USE_HANDLER_TABLE 1
+
+#include "host_plic.h"
+#include "system_MDR32VF0xI_config.h"
+#include "host.h"
+
+/* The PLIC is present on MDR32F02 only. */
+#if defined(USE_MDR32F02)
+#include "system_MDR32VF0xI_it.c"
+
+#define ID_DMA    1  /* DMA_IRQn + 1 */
+#define ID_UART1  2  /* UART1_IRQn + 1 */
+#define ID_TIMER1 7  /* TIMER1_IRQn + 1 */
+#define ID_OTP    30 /* OTP_IRQn + 1 */
+#define ID_LAST   PLIC_NUM_INTERRUPTS
+
+#define TRAP_MEPC 0x1000
+
+static uint32_t Order[16];
+static uint32_t OrderCount;
+static uint32_t Unexpected;
+static uint32_t Preemptions;
+static uint32_t Threshold[HOST_PLIC_NUM_IDS];
+static uint32_t DmaContext;
+
+static void Record(uint32_t ID)
+{
+    if (OrderCount < 16) {
+        Order[OrderCount] = ID;
+    }
+    OrderCount++;
+    Threshold[ID] = HOST_Plic.Threshold;
+}
+
+/* Take the machine external interrupt if it is enabled and requested, as the core does. */
+static void TakeExternalIRQ(void)
+{
+    uint_xlen_t MStatus = HOST_Csr[CSR_MSTATUS];
+
+    if (((MStatus & CSR_MSTATUS_MIE) == 0) || (HOST_PlicBest() == 0)) {
+        return;
+    }
+
+    /* Trap entry: MIE is moved to MPIE, MCAUSE and MEPC are overwritten. */
+    HOST_Csr[CSR_MSTATUS] = (MStatus & ~(uint_xlen_t)CSR_MSTATUS_MIE) | CSR_MSTATUS_MPIE;
+    HOST_Csr[CSR_MCAUSE]  = CSR_MCAUSE_EXCCODE_MEI | CSR_MCAUSE_INTERRUPT;
+    HOST_Csr[CSR_MEPC]    = 0xDEAD;
+    Preemptions++;
+
+    Trap_IRQHandler();
+
+    /* MRET: MPIE is moved back to MIE. */
+    HOST_Csr[CSR_MSTATUS] |= CSR_MSTATUS_MIE;
+}
+
+static void UnexpectedHandler(void)
+{
+    Unexpected++;
+}
+
+static void DmaHandler(void)
+{
+    Record(ID_DMA);
+}
+
+static void DmaContextHandler(void* Context)
+{
+    HOST_CHECK(Context == &DmaContext);
+    Record(ID_DMA);
+}
+
+static void Uart1Handler(void)
+{
+    Record(ID_UART1);
+}
+
+static void OtpHandler(void)
+{
+    Record(ID_OTP);
+}
+
+static void LastHandler(void)
+{
+    Record(ID_LAST);
+}
+
+/* PLIC_DispatchIRQ: UART1 becomes pending while TIMER1 is handled. */
+static void Timer1Handler(void)
+{
+    Record(ID_TIMER1);
+    HOST_PlicRaise(ID_UART1);
+}
+
+/* Nested: TIMER1 (higher priority) preempts UART1, DMA (same priority) does not. */
+static void Uart1NestedHandler(void)
+{
+    Record(ID_UART1);
+    HOST_CHECK((HOST_Csr[CSR_MSTATUS] & CSR_MSTATUS_MIE) != 0);
+
+    HOST_PlicRaise(ID_DMA);
+    TakeExternalIRQ();
+    HOST_CHECK(Preemptions == 0);
+
+    HOST_PlicRaise(ID_TIMER1);
+    TakeExternalIRQ();
+    HOST_CHECK(Preemptions == 1);
+    HOST_CHECK(HOST_Plic.Threshold == HOST_Plic.Priority[ID_UART1]);
+}
+
+static void Timer1NestedHandler(void)
+{
+    Record(ID_TIMER1);
+    TakeExternalIRQ();
+}
+
+static void ResetPlic(void)
+{
+    memset(&HOST_Plic, 0, sizeof(HOST_Plic));
+    memset(Threshold, 0, sizeof(Threshold));
+    HOST_Plic.Enable[0] = 0xFFFFFFFF;
+    HOST_Plic.Enable[1] = 0xFFFFFFFF;
+    OrderCount          = 0;
+}
+
+static void CheckCompletions(uint32_t Dispatched, uint32_t Loops)
+{
+    uint32_t ID;
+
+    /* Every loop ends with a claim returning 0, every source is completed once. */
+    HOST_CHECK(HOST_Plic.Claims == Dispatched + Loops);
+    HOST_CHECK(HOST_Plic.Completes == Dispatched);
+    HOST_CHECK(HOST_Plic.BadCompletes == 0);
+    for (ID = 0; ID < HOST_PLIC_NUM_IDS; ID++) {
+        HOST_CHECK(HOST_Plic.Claimed[ID] == 0);
+    }
+}
+
+int main(void)
+{
+    IRQHandler_TypeDef VectorTable[PLIC_NUM_INTERRUPTS];
+    uint32_t           IRQn;
+
+    for (IRQn = 0; IRQn < PLIC_NUM_INTERRUPTS; IRQn++) {
+        VectorTable[IRQn] = UnexpectedHandler;
+    }
+    VectorTable[ID_DMA - 1]    = DmaHandler;
+    VectorTable[ID_UART1 - 1]  = Uart1Handler;
+    VectorTable[ID_TIMER1 - 1] = Timer1Handler;
+    VectorTable[ID_OTP - 1]    = OtpHandler;
+    VectorTable[ID_LAST - 1]   = LastHandler;
+
+    /* PLIC_DispatchIRQ: the highest priority first, then by ID, the source raised meanwhile is handled too. */
+    ResetPlic();
+    HOST_Plic.Priority[ID_DMA]    = 1;
+    HOST_Plic.Priority[ID_UART1]  = 1;
+    HOST_Plic.Priority[ID_TIMER1] = 1;
+    HOST_Plic.Priority[ID_OTP]    = 1;
+    HOST_Plic.Priority[ID_LAST]   = 3;
+    HOST_PlicRaise(ID_DMA);
+    HOST_PlicRaise(ID_TIMER1);
+    HOST_PlicRaise(ID_OTP);
+    HOST_PlicRaise(ID_LAST);
+
+    HOST_CHECK(PLIC_DispatchIRQ(VectorTable) == 5);
+    HOST_CHECK(OrderCount == 5);
+    HOST_CHECK((Order[0] == ID_LAST) && (Order[1] == ID_DMA) && (Order[2] == ID_TIMER1) &&
+               (Order[3] == ID_UART1) && (Order[4] == ID_OTP));
+    HOST_CHECK(Unexpected == 0);
+    CheckCompletions(5, 1);
+
+    /* Nothing pending: one claim, no completion. */
+    ResetPlic();
+    HOST_CHECK(PLIC_DispatchIRQ(VectorTable) == 0);
+    CheckCompletions(0, 1);
+
+    /* Nested dispatch from the trap handler. */
+    ResetPlic();
+    ExtInterruptVectorTable[ID_DMA - 1]    = UnexpectedHandler;
+    ExtInterruptVectorTable[ID_UART1 - 1]  = Uart1NestedHandler;
+    ExtInterruptVectorTable[ID_TIMER1 - 1] = Timer1NestedHandler;
+    HOST_Plic.Threshold           = 1;
+    HOST_Plic.Priority[ID_DMA]    = 2;
+    HOST_Plic.Priority[ID_UART1]  = 2;
+    HOST_Plic.Priority[ID_TIMER1] = 5;
+    HOST_PlicRaise(ID_UART1);
+
+    HOST_Csr[CSR_MSTATUS] = CSR_MSTATUS_MIE;
+    IT_RegisterHandler((IRQn_TypeDef)(ID_DMA - 1), DmaContextHandler, &DmaContext);
+    HOST_CHECK(HOST_Csr[CSR_MSTATUS] == CSR_MSTATUS_MIE);
+
+    HOST_Csr[CSR_MSTATUS] = CSR_MSTATUS_MPIE;
+    HOST_Csr[CSR_MCAUSE]  = CSR_MCAUSE_EXCCODE_MEI | CSR_MCAUSE_INTERRUPT;
+    HOST_Csr[CSR_MEPC]    = TRAP_MEPC;
+    Trap_IRQHandler();
+
+    HOST_CHECK(OrderCount == 3);
+    HOST_CHECK((Order[0] == ID_UART1) && (Order[1] == ID_TIMER1) && (Order[2] == ID_DMA));
+    HOST_CHECK(Threshold[ID_UART1] == 2);
+    HOST_CHECK(Threshold[ID_TIMER1] == 5);
+    HOST_CHECK(Threshold[ID_DMA] == 2);
+    HOST_CHECK(Preemptions == 1);
+    HOST_CHECK(Unexpected == 0);
+    HOST_CHECK(HOST_Plic.Threshold == 1);
+    HOST_CHECK(HOST_Csr[CSR_MSTATUS] == CSR_MSTATUS_MPIE);
+    HOST_CHECK(HOST_Csr[CSR_MCAUSE] == (CSR_MCAUSE_EXCCODE_MEI | CSR_MCAUSE_INTERRUPT));
+    HOST_CHECK(HOST_Csr[CSR_MEPC] == TRAP_MEPC);
+    /* UART1 and DMA in the outer loop, TIMER1 in the nested one. */
+    CheckCompletions(3, 2);
+
+    /* The vector table handler is used again after the unregistration. */
+    HOST_Csr[CSR_MSTATUS] = CSR_MSTATUS_MIE;
+    IT_UnregisterHandler((IRQn_TypeDef)(ID_DMA - 1));
+    HOST_CHECK(HOST_Csr[CSR_MSTATUS] == CSR_MSTATUS_MIE);
+    HOST_CHECK((IT_HandlerTable[ID_DMA - 1].Handler == NULL) && (IT_HandlerTable[ID_DMA - 1].Context == NULL));
+    HOST_Csr[CSR_MSTATUS] = 0;
+    HOST_PlicRaise(ID_DMA);
+    Trap_IRQHandler();
+    HOST_CHECK(Unexpected == 1);
+
+    return HOST_RESULT();
+}
+#else
+int main(void)
+{
+    return HOST_RESULT();
+}
+#endif
+
+/*********************** (C) COPYRIGHT {YYYY} Milandr ****************************
+ *
+ * END OF FILE test_plic.c */
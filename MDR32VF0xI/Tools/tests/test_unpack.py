@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""
+Host test of the startup section decompression: the data is compressed by
+lz4_compress of image_compress.py and expanded by UNPACK_LZ4
+(system_MDR32VF0xI_unpack.c) built for the host as a shared library.
+The expanded data should match the original, the returned pointer should be
+the end of the LZ4 block and nothing should be written after the section end.
+
+Usage:
+
+    test_unpack.py [--cc CC]
+
+Copyright (C) {YYYY} Milandr
+"""
+
+import argparse
+import ctypes
+import os
+import random
+import shutil
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from image_compress import lz4_compress, LZ4_MAX_OFFSET  # noqa: E402
+from run_tests import CFLAGS, MCUS, ROOT, write_config  # noqa: E402
+
+# Bytes after the section end that should stay untouched
+GUARD_SIZE = 64
+GUARD_BYTE = 0xA5
+
+
+def build_unpack(cc, build):
+    """Build system_MDR32VF0xI_unpack.c as a host shared library, return UNPACK_LZ4."""
+    config = os.path.join(build, MCUS[0])
+    write_config(config, MCUS[0])
+    library = os.path.join(build, "libunpack.so")
+    command = [cc] + CFLAGS + [
+        "-shared", "-fPIC",
+        "-I" + config,
+        "-I" + os.path.join(ROOT, "DeviceSupport", "inc"), "-I" + os.path.join(ROOT, "CoreSupport", "inc"),
+        "-I" + os.path.join(ROOT, "DeviceSupport"),
+        os.path.join(ROOT, "DeviceSupport", "src", "system_MDR32VF0xI_unpack.c"), "-o", library,
+    ]
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+    if result.returncode != 0 or "warning:" in result.stdout:
+        print(result.stdout, end="")
+        return None
+    unpack = ctypes.CDLL(library).UNPACK_LZ4
+    unpack.restype = ctypes.c_void_p
+    unpack.argtypes = [ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p]
+    return unpack
+
+
+def check(unpack, name, data):
+    """Compress and expand the data, return the failure description or None."""
+    block = lz4_compress(data)
+    src = ctypes.create_string_buffer(block, len(block))
+    dst = ctypes.create_string_buffer(bytes([GUARD_BYTE]) * (len(data) + GUARD_SIZE), len(data) + GUARD_SIZE)
+    dst_start = ctypes.addressof(dst)
+
+    end = unpack(ctypes.addressof(src), dst_start, dst_start + len(data))
+
+    if dst.raw[:len(data)] != data:
+        index = next(i for i in range(len(data)) if dst.raw[i] != data[i])
+        return "%s: output differs at %d of %d" % (name, index, len(data))
+    if dst.raw[len(data):] != bytes([GUARD_BYTE]) * GUARD_SIZE:
+        return "%s: written after the section end" % name
+    if end - ctypes.addressof(src) != len(block):
+        return "%s: block end %d, expected %d" % (name, end - ctypes.addressof(src), len(block))
+    return None
+
+
+def test_data():
+    """Named inputs covering the token and the length encodings of the packer."""
+    rng = random.Random(47)
+    noise = bytes(rng.getrandbits(8) for _ in range(LZ4_MAX_OFFSET + 4096))
+    words = [b"lw", b"sw", b"addi", b"jal", b"ret", b"beqz", b" a0,", b" sp,", b" 0(a5)", b"\n"]
+    text = b"".join(rng.choice(words) for _ in range(20000))
+    return [
+        ("empty", b""),
+        ("single byte", b"\x5a"),
+        ("below the match limit", b"abcdabcdabc"),
+        ("random literals", noise[:1000]),
+        ("literal length over 255", noise[:15 + 255 + 3]),
+        ("zeros (offset 1)", bytes(70000)),
+        ("repeated words", b"\x13\x05\x00\x00\x93\x85\x05\x00" * 5000),
+        ("match length over 255", b"abcd" + bytes(15 + 4 + 255 + 10) + b"tail of data"),
+        ("text", text),
+        ("maximum offset", noise[:LZ4_MAX_OFFSET] + noise[:4096]),
+        ("beyond the maximum offset", noise + noise[:4096]),
+        ("packer source", open(os.path.join(ROOT, "Tools", "image_compress.py"), "rb").read()),
+    ]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Check UNPACK_LZ4 against image_compress.py on the host.")
+    parser.add_argument("--cc", default="gcc", help="host C compiler (gcc)")
+    args = parser.parse_args()
+
+    build = tempfile.mkdtemp(prefix="mdr32vf0xi_unpack_")
+    try:
+        unpack = build_unpack(args.cc, build)
+        if unpack is None:
+            print("UNPACK_LZ4 build failed")
+            return 1
+        failures = [f for f in (check(unpack, name, data) for name, data in test_data()) if f is not None]
+    finally:
+        shutil.rmtree(build)
+
+    for failure in failures:
+        print(failure)
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())